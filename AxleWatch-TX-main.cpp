@@ -8,13 +8,13 @@
  * Features:
  * - Interactive sensor identification via button and touch-to-identify
  * - 5-second button press to save sensor configuration
- * - EEPROM storage of sensor assignments
+ * - Versioned, CRC-checked config record in NVS (migrated from the old EEPROM layout)
  * - LoRa transmission at 433 MHz
  * - LED and buzzer feedback
  * - WiFi web interface for configuration and monitoring
  * - User-configurable transmitter ID (0-65535)
  * - Power-efficient operation with deep sleep
- * - Transmission format: TX<ID>:<temp1>,<temp2>,...,<ambient>
+ * - Transmission format: compact binary frame (see axlewatch_frame.h)
  */
 
 #include <Arduino.h>
@@ -22,11 +22,18 @@
 #include <DallasTemperature.h>
 #include <SPI.h>
 #include <LoRa.h>
-#include <EEPROM.h>
+#include <EEPROM.h>           // Only read to migrate the legacy layout
+#include <Preferences.h>
 #include <WiFi.h>
 #include <WebServer.h>
 #include <ArduinoJson.h>
 #include <driver/gpio.h>
+#include <time.h>
+#include <sys/time.h>
+#include "axlewatch_frame.h"  // Wire format shared with RX
+#include "axlewatch_log.h"    // Serial monitor ring
+#include "axlewatch_perf.h"   // Stage timing for /api/perf
+#include "tx_web_assets.h"  // Generated from web/ by tools/build_web_assets.py
 
 // Pin definitions (from README)
 #define ONE_WIRE_PIN   32
@@ -44,12 +51,67 @@
 
 // Configuration - ALIGNED WITH RX
 #define LORA_FREQUENCY 433E6        // 433 MHz
-#define LORA_TX_POWER  20           // 20 dBm
+#define LORA_TX_POWER  20           // 20 dBm (maximum; ADR works down from here)
 #define LORA_BANDWIDTH 125E3        // 125 kHz
 #define LORA_SPREADING_FACTOR 7     // SF7 - MUST MATCH RX!
 
+// Binary frame format, ACK and slot schedule: axlewatch_frame.h (shared with RX)
+// READINGS frames (keyframes) carry every configured sensor, DELTA frames only the changed ones
+#define FRAME_MAX_SIZE      (FRAME_HEADER_SIZE + MAX_SENSOR_COUNT * 2 + FRAME_CRC_SIZE)
+#define BATCH_MAX_READINGS  8           // Readings packed into one BATCH frame
+#define BATCH_READING_SIZE  (BATCH_READING_HEADER_SIZE + MAX_SENSOR_COUNT * 2)
+#define BATCH_FRAME_MAX_SIZE (FRAME_HEADER_SIZE + 1 + BATCH_MAX_READINGS * BATCH_READING_SIZE + FRAME_CRC_SIZE)
+#define READING_HISTORY_SIZE 64         // Transmitted readings kept for store-and-forward
+
+// Downlink ACK timing (layout in axlewatch_frame.h)
+#define ACK_AIRTIME_MS      51          // 18-byte ACK at SF7/BW125, corrects the reported phase and UTC
+#define ACK_AIRTIME_MS_V2   41          // 12-byte ACK
+#define ACK_WINDOW_MS       250         // Listen this long after each frame (0 = don't listen)
+#define BACKFILL_BATCHES_PER_CYCLE 2    // Bounds the extra awake time while catching up
+#define LORA_SNR_FLOOR_DB   (-2.5 * (LORA_SPREADING_FACTOR - 4))  // Demodulation limit for the SF
+
+// Adaptive TX power, driven by the uplink SNR RX reports in each ACK
+// The spreading factor stays fixed: RX listens on one SF only
+#define ENABLE_ADR          true
+#define ADR_MIN_TX_POWER    2           // dBm, lowest PA_BOOST setting
+#define ADR_TARGET_MARGIN_DB 10.0       // SNR headroom kept above LORA_SNR_FLOOR_DB
+#define ADR_STEP_DB         2           // Power change per adjustment
+#define ADR_MIN_SAMPLES     4           // ACKs averaged before stepping power down
+#define ADR_MISSED_ACKS     2           // Consecutive missed ACKs that step power up
+
+// Slotted transmit schedule (SLOT_* in axlewatch_frame.h)
+// Time is divided into frames of SLOT_COUNT slots; each TX sends at the start of its slot
+// Synced: slot and frame phase come from RX's ACK. Unsynced (no ACK yet, or RX had no
+// slot free): slot from transmitterID on our own clock, plus random jitter so two
+// unsynced TXs cannot stay locked together
+#define SLOT_SYNC_MAX_AGE_MS 600000     // RTC slow clock drift makes older sync useless
+
+// Listen-before-talk via channel activity detection
+#define LBT_MAX_ATTEMPTS    4           // Then transmit anyway
+#define LBT_BACKOFF_MIN_MS  20
+#define LBT_BACKOFF_MAX_MS  120
+#define LBT_CAD_TIMEOUT_MS  10          // CAD takes ~2 symbols (2 ms at SF7)
+
 #define MAX_SENSOR_COUNT 10
-#define TEMP_PRECISION 12           // 12-bit resolution (0.0625°C)
+#define TEMP_PRECISION 12           // 12-bit resolution (0.0625°C) - full/escalated resolution
+#define TEMP_PRECISION_MIN 9        // 9-bit (0.5°C), each bit less halves conversion time
+#define DEFAULT_RESOLUTION 10       // 10-bit (0.25°C, 188ms) default for every slot
+#define RESOLUTION_ESCALATE_DELTA_C 30.0  // Hub this far above ambient goes to 12-bit (RX warns at 40)
+#define RESOLUTION_HYSTERESIS_C 2.0       // ...and drops back once 2°C below that
+
+// OneWire bus health (see readSensor) - long harnesses to each wheel end fail
+// as CRC errors, missing presence pulses and sensors browning out to 85°C
+#define SENSOR_READ_RETRIES 2             // Extra reads of a failing sensor, within the same cycle
+#define SENSOR_POR_CENTI 8500             // DS18B20 power-on-reset register value (85.00°C)
+#define SENSOR_POR_PLAUSIBLE_C 5.0        // 85.00°C is believed if the last good reading was this close
+
+// Config store: one ConfigRecord blob in NVS, written whole (NVS appends a new
+// entry and retires the old one, so a write is atomic and wear-levelled)
+#define CONFIG_NAMESPACE "axlewatch"
+#define CONFIG_KEY "config"
+#define CONFIG_VERSION 1            // Bump when ConfigRecord changes, and migrate in loadConfigStore()
+
+// Legacy EEPROM layout - read once by migrateLegacyConfig(), never written
 #define EEPROM_SIZE 512
 #define EEPROM_MAGIC 0xABCD         // Magic number to verify EEPROM is initialized
 #define EEPROM_MAGIC_ADDR 0
@@ -58,18 +120,71 @@
 #define EEPROM_NAME_ADDR 88         // Start address for device name
 #define EEPROM_TRANSMITTER_ID_ADDR 120  // Address for transmitter ID (uint16_t)
 #define EEPROM_POWER_MODE_ADDR 122  // Address for power save mode flag
+#define EEPROM_RESOLUTION_ADDR 124  // Per-sensor resolution profile (ResolutionProfile)
 
 #define BUTTON_SAVE_PRESS_MS 5000   // 5 seconds to save sensor setup
 #define BUTTON_SETUP_PRESS_MS 3000  // 3 seconds to enter setup mode
-#define TRANSMIT_INTERVAL_MS 30000  // 30 seconds between transmissions (power efficient)
-#define DEEP_SLEEP_DURATION_US 30000000  // 30 seconds in microseconds
-#define TEMP_CHANGE_THRESHOLD 1.5   // °C change to detect sensor touch
+
+// Touch-to-identify commissioning (setup mode) - see commissionUpdate()
+// A touched sensor is found by its rise rate against the rest of the bus, so
+// ambient drift (which moves every sensor together) cannot assign a position
+#define COMMISSION_MAX_DEVICES 16
+#define COMMISSION_RESOLUTION 10          // 10-bit (0.25°C, 188ms) scans 4x faster than 12-bit
+#define COMMISSION_SCAN_MS 250            // Scan period, start to start
+#define COMMISSION_SLOPE_SCANS 8          // Least-squares slope over the last 2 s of scans
+#define COMMISSION_BASELINE_ALPHA 0.05    // Baseline EMA weight per scan (untouched sensors only)
+#define COMMISSION_TOUCH_SLOPE_C_PER_S 0.2  // Rise rate above the bus-wide drift that counts as a touch
+#define COMMISSION_TOUCH_RISE_C 0.5       // ...once the sensor is this far above its baseline
+#define COMMISSION_CONFIRM_SCANS 2        // Consecutive scans a touch has to hold
+#define COMMISSION_LEAD_RATIO 2.0         // and it must rise this many times faster than the runner-up
+#define COMMISSION_IDLE_TIMEOUT_MS 60000  // No assignment for this long ends setup (saves if ambient is set)
+
+// Adaptive sampling: the interval between readings (and the deep sleep duration)
+// is recomputed every cycle from the hubs' temperature trend
+#define SAMPLE_INTERVAL_MIN_MS  2000     // Fastest rate, for a hub heating up quickly
+#define SAMPLE_INTERVAL_BASE_MS 30000    // Normal rate (and rate after boot)
+#define SAMPLE_INTERVAL_HOT_MS  10000    // Never slower than this while a hub runs hot
+#define SAMPLE_INTERVAL_MAX_MS  300000   // Slowest rate, everything stable near ambient
+#define TREND_RISE_REF_C_PER_MIN 0.5     // Delta-over-ambient rise sampled at the base rate;
+                                         // faster rises shorten the interval proportionally
+#define TREND_STABLE_C_PER_MIN   0.2     // Rise below this counts as stable
+#define TREND_STABLE_DELTA_C     5.0     // Hubs within this of ambient may stretch the interval
+#define TREND_HOT_DELTA_C        30.0    // Hub this far above ambient is "hot" (RX warns at 40)
+
+// Change-only transmit policy: full keyframe at least every KEYFRAME_INTERVAL_MS, delta
+// frames in between only when a sensor moved more than the threshold
+#define KEYFRAME_INTERVAL_MS 300000 // Full frame at least every 5 minutes
+#define DELTA_THRESHOLD_C 0.5       // °C change that triggers a delta frame between keyframes
 
 // WiFi Configuration (Access Point Mode)
 #define WIFI_AP_SSID "AxleWatch-TX"
 #define WIFI_AP_PASSWORD "axlewatch123"
 #define MAX_DEVICE_NAME_LENGTH 32
 #define SERIAL_BUFFER_SIZE 100      // Number of serial log entries to keep
+#define SERIAL_LOG_MESSAGE_LENGTH 176 // Fixed record size, fits a full 10-sensor data line
+#define HEAP_FRAGMENTED_PCT 50      // Fragmentation above this counts as a fragmented cycle
+
+// Server-sent events (/api/events) - pushes dashboard updates instead of polling
+#define EVENT_MAX_CLIENTS   2
+#define EVENT_KEEPALIVE_MS  15000       // Comment line so proxies/browsers keep the stream open
+#define EVENT_DATA          0x01        // latestData changed
+#define EVENT_LORA          0x02        // loraStats changed
+#define EVENT_COMMISSION    0x04        // Commissioning state changed (setup mode)
+
+// Web server task - HTTP runs beside loop() so neither can stall the other
+#define WEB_TASK_STACK      12288       // Commissioning JSON lists up to 16 sensors
+#define WEB_TASK_PRIORITY   1
+#define WEB_TASK_CORE       0           // loop() runs on core 1
+
+// Stage timing for /api/perf (PerfStage, esp_timer microseconds)
+#define PERF_CONVERSION     0           // startConversion() until the readings are taken
+#define PERF_SENSOR_READ    1           // Scratchpad reads of every configured sensor
+#define PERF_FRAME_BUILD    2           // Encoding a READINGS/DELTA frame
+#define PERF_AIRTIME        3           // LoRa.beginPacket() to endPacket() - time on air
+#define PERF_ACK_WAIT       4           // Listening for the ACK after a frame
+#define PERF_CYCLE          5           // readAndTransmitData() as a whole
+#define PERF_LOOP_GAP       6           // loop() start to start - the button/conversion poll jitter
+#define PERF_STAGE_COUNT    7
 
 // OneWire and Dallas Temperature
 OneWire oneWire(ONE_WIRE_PIN);
@@ -82,52 +197,371 @@ struct SensorConfig {
 };
 
 SensorConfig sensorConfig;
+
+// Per-sensor resolution profile (stored in ConfigRecord with the sensor addresses)
+// bits[0] is ambient, bits[1-9] the additional positions
+struct ResolutionProfile {
+  uint8_t bits[MAX_SENSOR_COUNT];  // Base resolution, TEMP_PRECISION_MIN..TEMP_PRECISION
+  bool autoEscalate;               // Raise hubs nearing the warn threshold to TEMP_PRECISION
+};
+
+ResolutionProfile resolutionProfile;
+uint8_t activeResolution[MAX_SENSOR_COUNT] = {0};  // Resolution each sensor is set to (0 = unknown,
+                                                   // so every boot re-checks the sensors)
+
+// Per-slot OneWire read health, reported in /api/data (RTC memory so the
+// counts survive deep sleep; cleared when setup assigns new sensors)
+struct SensorHealth {
+  unsigned long reads;               // Cycles this slot was read
+  unsigned long crcErrors;           // Scratchpad failed its CRC
+  unsigned long disconnects;         // No presence pulse, or an all-0x00/0xFF scratchpad
+  unsigned long powerOnResets;       // 85.00°C power-on value (sensor browned out)
+  unsigned long retries;             // Extra reads spent on this slot
+  unsigned long invalid;             // Cycles sent as FRAME_CENTI_INVALID after every retry failed
+  uint16_t lastReadUs;               // Bus time reading this slot last cycle, retries included
+  uint16_t maxReadUs;
+  bool haveGood;
+  int16_t lastGoodCenti;             // Last valid reading, to judge a genuine 85.00°C
+};
+RTC_DATA_ATTR SensorHealth sensorHealth[MAX_SENSOR_COUNT] = {};
+
+// Outcome of one scratchpad read
+#define SENSOR_OK            0
+#define SENSOR_DISCONNECTED  1
+#define SENSOR_CRC_ERROR     2
+#define SENSOR_POWER_ON      3
+
+// Everything persisted, as stored in NVS (CRC-16 over all fields before crc)
+// save*() stage changes here and mark it dirty; commitConfig() writes it in one go
+struct __attribute__((packed)) ConfigRecord {
+  uint8_t version;                          // CONFIG_VERSION
+  bool sensorsSaved;                        // sensors/sensorCount hold a completed setup
+  uint8_t sensorCount;
+  uint8_t sensors[MAX_SENSOR_COUNT][8];
+  char name[MAX_DEVICE_NAME_LENGTH];
+  uint16_t transmitterID;
+  bool powerSaveMode;
+  ResolutionProfile resolution;
+  uint16_t crc;
+};
+
+ConfigRecord storedConfig;
+bool configDirty = false;                   // storedConfig differs from NVS
+
+RTC_DATA_ATTR bool resolutionEscalated[MAX_SENSOR_COUNT] = {false};  // Escalation survives deep sleep
+uint8_t conversionResolution = TEMP_PRECISION;     // Highest active resolution, sets conversion time
 bool sensorsConfigured = false;
 unsigned long lastTransmitTime = 0;
 uint8_t activeSensorCount = 1;  // Number of sensors actually configured (minimum 1 for ambient)
 uint16_t transmitterID = 1;     // User-configurable transmitter ID (0-65535)
 bool powerSaveMode = false;     // Enable deep sleep for power efficiency
+RTC_DATA_ATTR uint8_t frameSequence = 0;  // Survives deep sleep so RX sees a continuous sequence
+
+// Transmit policy state (RTC memory so it survives deep sleep)
+struct TransmitPolicy {
+  bool haveKeyframe;                         // false forces next cycle to send a keyframe
+  uint8_t keyframeSensorCount;               // activeSensorCount when last keyframe was sent
+  unsigned long msSinceKeyframe;
+  int16_t lastSentCenti[MAX_SENSOR_COUNT];   // What RX currently holds for each slot
+};
+RTC_DATA_ATTR TransmitPolicy txPolicy = {false, 0, 0, {0}};
+
+// Adaptive sampling schedule (RTC memory so the trend survives deep sleep)
+struct SampleSchedule {
+  unsigned long intervalMs;                  // Time from the last sample to the next one
+  bool havePrevious;
+  uint8_t previousCount;                     // activeSensorCount of the previous sample
+  int16_t previousCenti[MAX_SENSOR_COUNT];
+};
+RTC_DATA_ATTR SampleSchedule sampleSchedule = {SAMPLE_INTERVAL_BASE_MS, false, 0, {0}};
+
+// Store-and-forward history of transmitted readings (RTC slow memory, survives deep sleep)
+// Readings stay undelivered until RX confirms the frame that carried them;
+// transmitBackfill() re-sends the undelivered ones, oldest first, in BATCH frames
+struct StoredReading {
+  uint32_t takenAt;                  // txClockSeconds() when sampled
+  uint8_t sequence;                  // Sequence of the live frame it first went out in (RX dedup key)
+  uint8_t lastFrame;                 // Sequence of the latest frame that carried it
+  bool delivered;
+  int16_t centi[MAX_SENSOR_COUNT];
+};
+
+struct ReadingHistory {
+  uint8_t head;                      // Next slot to write
+  uint8_t count;
+  uint8_t sensorCount;               // activeSensorCount all stored readings were taken with
+  StoredReading readings[READING_HISTORY_SIZE];
+};
+RTC_DATA_ATTR ReadingHistory history = {0, 0, 0, {}};
+
+// Adaptive TX power state (RTC slow memory, survives deep sleep)
+struct PowerControl {
+  int8_t txPowerDbm;
+  float marginAvgDb;                 // Running average of the reported link margin
+  uint8_t samples;                   // ACKs averaged at the current power
+  uint8_t missedAcks;                // Consecutive frames without ACK
+  unsigned long powerChanges;
+};
+RTC_DATA_ATTR PowerControl powerControl = {LORA_TX_POWER, 0, 0, 0, 0};
+
+// Transmit slot sync from RX (RTC slow memory, survives deep sleep)
+struct SlotSync {
+  bool synced;
+  uint8_t slot;                      // Assigned by RX
+  uint16_t frameOriginMs;            // Start of RX's slot frame on txClockMs(), modulo SLOT_FRAME_MS
+  uint64_t syncedAtMs;               // txClockMs() of the ACK it came from
+};
+RTC_DATA_ATTR SlotSync slotSync = {false, 0, 0, 0};
+
+// UTC from RX's ACKs (RX clock is GPS/NTP disciplined), as an offset on txClockMs()
+struct UtcSync {
+  bool synced;
+  int64_t offsetMs;                  // UTC minus txClockMs()
+  uint64_t syncedAtMs;               // txClockMs() of the ACK it came from
+};
+RTC_DATA_ATTR UtcSync utcSync = {false, 0, 0};
+
+uint64_t cycleTxAtMs = 0;            // txClockMs() when this cycle's frame was due
+
+// Channel activity detection result (set from the DIO0 interrupt)
+volatile bool cadDone = false;
+volatile bool cadDetected = false;
+
+// Resolved configuration kept across deep sleep, so a timer wake skips the NVS
+// read, the loaders and the OneWire bus search (valid only while power save is on)
+struct WakeCache {
+  bool valid;
+  SensorConfig sensorConfig;
+  uint8_t sensorCount;
+  uint16_t transmitterID;
+  ResolutionProfile resolution;
+  char name[MAX_DEVICE_NAME_LENGTH];
+};
+RTC_DATA_ATTR WakeCache wakeCache = {false};
+
+// Time spent awake per power-save cycle - the battery budget
+struct AwakeStats {
+  unsigned long cycles;
+  unsigned long lastMs;
+  unsigned long maxMs;
+  uint64_t totalMs;
+};
+RTC_DATA_ATTR AwakeStats awakeStats = {0, 0, 0, 0};
 
 // WiFi and Web Server
 WebServer server(80);
 char deviceName[MAX_DEVICE_NAME_LENGTH] = "AxleWatch-TX";
 
-// Serial monitor circular buffer
-struct SerialLogEntry {
-  unsigned long timestamp;
-  String message;
+// Serial monitor circular buffer (axlewatch_log.h); written drives the log event stream
+typedef LogRing<SERIAL_BUFFER_SIZE, SERIAL_LOG_MESSAGE_LENGTH> SerialLog;
+typedef SerialLog::Entry SerialLogEntry;
+SerialLog serialLog;
+
+// Server-sent event clients (sockets kept open after their /api/events request)
+WiFiClient eventClients[EVENT_MAX_CLIENTS];
+uint8_t eventsPending = 0;           // EVENT_* flags not yet pushed
+unsigned long serialLogPublished = 0;
+unsigned long lastEventSent = 0;
+
+// Heap health, sampled once per transmit cycle (see sampleHeap)
+struct HeapStats {
+  uint8_t fragmentationPct;          // 100 - largest free block as % of free heap
+  uint8_t peakFragmentationPct;
+  unsigned long fragmentedCycles;    // Cycles above HEAP_FRAGMENTED_PCT
+} heapStats = {0, 0, 0};
+
+// Non-blocking DS18B20 conversion (sensors.setWaitForConversion(false))
+// The conversion runs on the sensors while loop() keeps serving web/button
+struct ConversionPipeline {
+  bool pending;
+  unsigned long startedAt;
+  unsigned long waitMs;          // Worst-case conversion time for TEMP_PRECISION
+  int64_t startedUs;             // esp_timer_get_time() at the start, for PERF_CONVERSION
+} conversion = {false, 0, 0, 0};
+
+// Stage timings, recorded by loop() and published through webSnapshot; the web
+// task records its own handlers in webPerf (only it ever touches that one)
+PerfStage perfStages[PERF_STAGE_COUNT] = {};
+PerfStage webPerf = {};
+const char* const perfStageNames[PERF_STAGE_COUNT] = {
+  "conversion", "sensorRead", "frameBuild", "airtime", "ackWait", "cycle", "loopGap"
+};
+
+// Commissioning engine (setup mode): scans every sensor on the bus at
+// COMMISSION_RESOLUTION and assigns positions in order, ambient first,
+// to whichever sensor is touched - or to the one picked in the web UI
+struct CommissionDevice {
+  DeviceAddress address;
+  float tempC;                               // Latest reading
+  float baselineC;                           // EMA of the reading while untouched
+  float slopeCPerS;                          // Least-squares slope over the recent scans
+  float recent[COMMISSION_SLOPE_SCANS];      // Ring of the last readings (shares scanAt's index)
+  bool recentValid;                          // recent[] seeded; cleared by a missed read
+  uint8_t risingScans;                       // Consecutive scans passing the touch test
+  bool latched;                              // Already acted on for this touch, rearms once it stops rising
+  int8_t position;                           // Assigned position, -1 = none
+};
+
+struct Commissioning {
+  bool active;
+  uint8_t deviceCount;
+  uint8_t position;                          // Next position to fill (0 = ambient)
+  uint8_t order[MAX_SENSOR_COUNT];           // Device index assigned to each position
+  CommissionDevice devices[COMMISSION_MAX_DEVICES];
+  unsigned long scanAt[COMMISSION_SLOPE_SCANS];
+  uint8_t recentHead;
+  uint8_t recentCount;
+  bool scanPending;
+  unsigned long scanStartedAt;
+  unsigned long scanWaitMs;
+  unsigned long lastActivity;                // Start or last assignment, for the idle timeout
+  unsigned long buttonDownAt;                // 0 = button up
+  bool buttonArmed;                          // Released once since setup started (entry hold ignored)
+  unsigned long startedAt;
+  unsigned long scans;
+  char message[64];                          // Prompt / last event, shown in the web UI
+} commissioning = {};
+
+// What the web UI shows of the engine, copied into webSnapshot
+struct CommissionView {
+  bool active;
+  uint8_t deviceCount;
+  uint8_t position;
+  unsigned long scans;
+  unsigned long elapsedMs;
+  char message[64];
+  struct {
+    uint8_t address[8];
+    float tempC;
+    float slopeCPerS;
+    int8_t position;
+  } devices[COMMISSION_MAX_DEVICES];
 };
-SerialLogEntry serialBuffer[SERIAL_BUFFER_SIZE];
-int serialBufferIndex = 0;
-int serialBufferCount = 0;
+
+// Commissioning commands posted to /api/commission, applied by loop()
+#define COMMISSION_CMD_START  1
+#define COMMISSION_CMD_ASSIGN 2
+#define COMMISSION_CMD_UNDO   3
+#define COMMISSION_CMD_SAVE   4
+#define COMMISSION_CMD_CANCEL 5
+
+struct CommissionRequest {
+  uint8_t command;                           // COMMISSION_CMD_*, 0 = none
+  uint8_t device;                            // For ASSIGN
+} pendingCommission = {0, 0};
 
 // Latest sensor data (for web display)
 struct SensorData {
   float temps[MAX_SENSOR_COUNT];  // temps[0] is ambient, temps[1-9] are additional sensors
-  unsigned long timestamp;
+  int16_t centi[MAX_SENSOR_COUNT]; // temps as encoded for the radio, computed once per cycle
+  unsigned long timestamp;         // UTC seconds when utcSynced, else seconds since boot
+  bool utcSynced;
   bool valid;
-} latestData = {{0}, 0, false};
+} latestData = {{0}, {0}, 0, false, false};
 
 // LoRa statistics
 struct LoRaStats {
   unsigned long totalPackets;
   unsigned long lastPacketTime;
-  int rssi;
+  int rssi;                       // Last ACK as heard here (downlink)
   float snr;
-} loraStats = {0, 0, 0, 0};
+  int uplinkRssi;                 // Our last frame as heard by RX, reported in its ACK
+  float uplinkSnr;
+  unsigned long acksExpected;     // Frames followed by an ACK window
+  unsigned long acksReceived;
+  unsigned long lbtBackoffs;      // Times the channel was busy before sending
+  unsigned long lbtForced;        // Frames sent after LBT gave up
+  unsigned long keyframes;        // Full READINGS frames sent
+  unsigned long deltaFrames;      // DELTA frames sent
+  unsigned long suppressedCycles; // Cycles skipped because nothing changed
+  unsigned long backfillFrames;   // BATCH frames re-sending stored readings
+} loraStats = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+// Copy of the loop's state for the web task, refreshed by publishSnapshot()
+// Handlers only ever read this, never the live globals
+struct WebSnapshot {
+  SensorData data;
+  uint8_t sensorCount;
+  unsigned long sampleIntervalMs;
+  LoRaStats lora;
+  uint8_t storedReadings;
+  int undeliveredReadings;
+  PowerControl power;
+  bool slotSynced;
+  uint8_t slot;
+  char name[MAX_DEVICE_NAME_LENGTH];
+  uint16_t transmitterID;
+  bool powerSaveMode;
+  ResolutionProfile resolution;
+  uint8_t activeResolution[MAX_SENSOR_COUNT];
+  SensorHealth health[MAX_SENSOR_COUNT];
+  PerfStage perf[PERF_STAGE_COUNT];
+  AwakeStats awake;
+  CommissionView commission;
+} webSnapshot;
+
+// Settings posted to /api/config, applied by loop() (see applyPendingConfig)
+struct ConfigRequest {
+  bool pending;
+  bool hasName;
+  char name[MAX_DEVICE_NAME_LENGTH];
+  bool hasTransmitterID;
+  uint16_t transmitterID;
+  bool hasPowerSaveMode;
+  bool powerSaveMode;
+  uint8_t resolutions[MAX_SENSOR_COUNT];  // 0 = unchanged
+  bool hasAutoResolution;
+  bool autoResolution;
+} pendingConfig = {};
+
+SemaphoreHandle_t stateMutex = nullptr;  // Guards webSnapshot, pendingConfig and eventsPending
+SemaphoreHandle_t logMutex = nullptr;    // Guards the serial log ring
+TaskHandle_t webTaskHandle = nullptr;
 
 // Forward declarations
 void enterSetupMode();
-void scanAndIdentifySensors();
+void commissionStart();
+void commissionUpdate();
+void commissionScan(unsigned long now);
+void commissionAssign(int device);
+void commissionUndo();
+void commissionFinish(bool save);
+void commissionPrompt();
+void applyPendingCommission();
 void saveSensorConfig();
 void loadSensorConfig();
 bool checkButtonPress(unsigned long duration);
 void playTone(int frequency, int duration);
 void blinkLED(int pin, int times, int delayMs);
+void startConversion();
+bool conversionReady();
+void waitForConversionAsleep();
 void readAndTransmitData();
+void transmitReadings();
+void scheduleNextSample();
+size_t buildFrame(uint8_t* frame, uint8_t type, uint16_t mask);
+size_t writeFrameHeader(uint8_t* frame, uint8_t type, uint16_t mask);
+uint32_t txClockSeconds();
+void storeReading(uint8_t sequence);
+void markFrameDelivered(uint8_t frameSeq);
+int undeliveredReadings();
+int transmitBackfill(uint8_t* sequence);
+bool awaitAck(uint8_t sequence);
+void backfillHistory();
+void updateTxPower(bool acked);
+void setTxPower(int8_t dbm);
+uint64_t txClockMs();
+uint32_t utcSeconds();
+bool slotSynced();
+void alignToSlot();
+void sendFrame(const uint8_t* frame, size_t len);
+bool channelBusy();
+void onCadDone(bool detected);
+int16_t toCenti(float tempC);
+int16_t readSensor(int index);
+uint8_t readScratchpadCenti(const uint8_t* address, int16_t* centi);
+bool centiValid(int16_t centi);
 void printSensorAddress(uint8_t* addr);
-int findSensorByTouch(DeviceAddress* allSensors, float* baselines, int count);
-bool isDuplicateSensor(uint8_t* newAddr, int excludeIndex);
 bool validateUniqueConfig();
 void setupWiFi();
 void setupWebServer();
@@ -135,21 +569,51 @@ void saveDeviceName();
 void loadDeviceName();
 void saveTransmitterConfig();
 void loadTransmitterConfig();
-void logToSerial(const String& message);
-String getSerialLogs();
+void saveResolutionProfile();
+void loadResolutionProfile();
+void loadConfigStore();
+bool migrateLegacyConfig();
+void stageConfig(void* field, const void* value, size_t len);
+bool commitConfig();
+void applySensorResolutions();
+void logToSerial(const char* format, ...) __attribute__((format(printf, 1, 2)));
+void sampleHeap();
+void perfRecord(uint8_t stage, int64_t startedUs);
+size_t appendJsonString(char* out, size_t size, const char* text);
 void enterDeepSleep();
+void saveWakeCache();
+void restoreWakeCache();
 
 // Web server handlers
 void handleRoot();
+void sendStaticPage(const uint8_t* gz, size_t len, const char* etag);
 void handleApiConfigGet();
 void handleApiConfigPost();
 void handleApiData();
 void handleApiLora();
 void handleApiSerial();
+void handleApiEvents();
+void handleApiCommissionGet();
+void handleApiCommissionPost();
+void handleApiPerf();
+void fillPerfStageJson(JsonObject out, const PerfStage& stage);
+void fillCommissionJson(JsonDocument& doc, const WebSnapshot& snap);
+void fillDataJson(JsonDocument& doc, const WebSnapshot& snap);
+void fillLoraJson(JsonDocument& doc, const WebSnapshot& snap);
+void publishEvents();
+void sendEvent(const char* name, const char* data, size_t len);
+void webServerTask(void* param);
+void publishSnapshot(uint8_t events);
+WebSnapshot takeSnapshot();
+void applyPendingConfig();
+bool copyLogEntry(unsigned long written, SerialLogEntry* out);
 
 void setup() {
   Serial.begin(115200);
 
+  stateMutex = xSemaphoreCreateMutex();
+  logMutex = xSemaphoreCreateMutex();
+
   // Check if waking from deep sleep
   esp_sleep_wakeup_cause_t wakeReason = esp_sleep_get_wakeup_cause();
   bool fromDeepSleep = (wakeReason == ESP_SLEEP_WAKEUP_TIMER);
@@ -209,18 +673,31 @@ void setup() {
     }
   }
 
-  // Initialize EEPROM
-  EEPROM.begin(EEPROM_SIZE);
+  // A timer wake in power save mode only takes a reading: use the cached
+  // configuration instead of reading and validating the config record again
+  bool fastWake = fromDeepSleep && wakeCache.valid;
 
-  // Initialize OneWire sensors
-  sensors.begin();
-  sensors.setResolution(TEMP_PRECISION);
-  Serial.printf("Found %d OneWire devices\n", sensors.getDeviceCount());
+  if (fastWake) {
+    restoreWakeCache();
+  } else {
+    // Read the config record (migrating the old EEPROM layout on first boot)
+    loadConfigStore();
+  }
+
+  // Initialize OneWire sensors - the bus search is only needed to resolve
+  // addresses, and a fast wake already has them in sensorConfig
+  if (!fastWake) {
+    sensors.begin();
+    Serial.printf("Found %d OneWire devices\n", sensors.getDeviceCount());
+  }
+  sensors.setAutoSaveScratchPad(false); // Resolution changes stay in scratchpad, not sensor EEPROM
+  sensors.setWaitForConversion(false);  // requestTemperatures() returns immediately
 
-  // Initialize LoRa
+  // Initialize LoRa - after deep sleep the SX127x is still powered in sleep mode
+  // with its registers intact, so it is not reset (saves the 20 ms reset pulse)
   Serial.println("Initializing LoRa...");
   SPI.begin(LORA_SCK_PIN, LORA_MISO_PIN, LORA_MOSI_PIN, LORA_CS_PIN);
-  LoRa.setPins(LORA_CS_PIN, LORA_RST_PIN, LORA_DIO0_PIN);
+  LoRa.setPins(LORA_CS_PIN, fromDeepSleep ? -1 : LORA_RST_PIN, LORA_DIO0_PIN);
 
   if (!LoRa.begin(LORA_FREQUENCY)) {
     Serial.println("LoRa init failed!");
@@ -230,21 +707,31 @@ void setup() {
     }
   }
 
-  LoRa.setTxPower(LORA_TX_POWER);
+  LoRa.setTxPower(powerControl.txPowerDbm);  // Power ADR settled on before deep sleep
   LoRa.setSignalBandwidth(LORA_BANDWIDTH);
   LoRa.setSpreadingFactor(LORA_SPREADING_FACTOR);
   LoRa.disableCrc(); // Explicitly disable CRC to match RX configuration
+  LoRa.onCadDone(onCadDone);
   Serial.println("LoRa initialized successfully");
   Serial.printf("LoRa Config: 433MHz, SF%d, BW125kHz\n", LORA_SPREADING_FACTOR);
 
-  // Load sensor configuration from EEPROM
-  loadSensorConfig();
+  if (!fastWake) {
+    // Load sensor configuration
+    loadSensorConfig();
+
+    // Load device name
+    loadDeviceName();
 
-  // Load device name from EEPROM
-  loadDeviceName();
+    // Load transmitter configuration (ID and power mode)
+    loadTransmitterConfig();
+
+    // Load per-sensor resolutions
+    loadResolutionProfile();
+  }
 
-  // Load transmitter configuration (ID and power mode) from EEPROM
-  loadTransmitterConfig();
+  // Program the sensors with their resolutions (re-checked every boot, in case
+  // a sensor lost power and fell back to its EEPROM default)
+  applySensorResolutions();
 
   // Setup WiFi and Web Server (only on cold boot, not needed for deep sleep wake)
   if (!fromDeepSleep) {
@@ -276,8 +763,12 @@ void setup() {
     digitalWrite(LED_GREEN_PIN, LOW);
   }
 
+  publishSnapshot(0);
+
   // If waking from deep sleep, transmit immediately and go back to sleep
   if (fromDeepSleep && sensorsConfigured && powerSaveMode) {
+    startConversion();
+    waitForConversionAsleep();
     readAndTransmitData();
     Serial.println("Returning to deep sleep...");
     delay(100);
@@ -286,20 +777,39 @@ void setup() {
 }
 
 void loop() {
-  // Handle web server requests (only if WiFi was started)
-  if (!powerSaveMode) {
-    server.handleClient();
+  static int64_t lastLoopUs = 0;
+  int64_t loopUs = esp_timer_get_time();
+  if (lastLoopUs) perfStages[PERF_LOOP_GAP].record((uint32_t)(loopUs - lastLoopUs));
+  lastLoopUs = loopUs;
+
+  // HTTP is served by webServerTask; commands and settings it received are applied here
+  applyPendingCommission();
+
+  // Setup mode: the commissioning engine has the OneWire bus and the button,
+  // posted settings wait in pendingConfig until it finishes
+  if (commissioning.active) {
+    commissionUpdate();
+    delay(5);
+    return;
   }
 
+  applyPendingConfig();
+
   // Check for button press to enter setup mode (3 seconds)
   if (checkButtonPress(BUTTON_SETUP_PRESS_MS)) {
     enterSetupMode();
   }
 
-  // Transmit data at regular intervals
-  if (sensorsConfigured && (millis() - lastTransmitTime >= TRANSMIT_INTERVAL_MS)) {
+  // Start a conversion at the scheduled interval (measured start to start)
+  if (sensorsConfigured && !conversion.pending &&
+      (millis() - lastTransmitTime >= sampleSchedule.intervalMs)) {
+    startConversion();
+    lastTransmitTime = conversion.startedAt;
+  }
+
+  // Read and transmit once the sensors have finished converting
+  if (conversionReady()) {
     readAndTransmitData();
-    lastTransmitTime = millis();
 
     // If power save mode is enabled, enter deep sleep after transmission
     if (powerSaveMode) {
@@ -350,7 +860,7 @@ bool checkButtonPress(unsigned long duration) {
 }
 
 /**
- * Enter setup mode - identify and assign sensors
+ * Enter setup mode - start the commissioning engine, which loop() then drives
  */
 void enterSetupMode() {
   Serial.println("\n========================================");
@@ -358,6 +868,7 @@ void enterSetupMode() {
   Serial.println("========================================");
   Serial.println("First sensor will be AMBIENT (required)");
   Serial.println("Then assign up to 9 more sensors");
+  Serial.println("Touch each sensor in turn, or assign them from the web page");
   Serial.println("Press button for 5 seconds to SAVE");
 
   // Alert the user
@@ -376,17 +887,20 @@ void enterSetupMode() {
     delay(200);
   }
 
-  scanAndIdentifySensors();
-
-  Serial.println("========================================\n");
+  commissionStart();
 }
 
 /**
- * Scan for sensors and identify them through touch
+ * Scan the bus and start commissioning. Every sensor found is a candidate for
+ * ambient and positions 1-9; nothing is stored until commissionFinish(true)
  */
-void scanAndIdentifySensors() {
-  DeviceAddress allSensors[16];
+void commissionStart() {
+  if (commissioning.active) return;
+
+  // Search again so sensors connected since boot are found too
+  sensors.begin();
   int deviceCount = sensors.getDeviceCount();
+  if (deviceCount > COMMISSION_MAX_DEVICES) deviceCount = COMMISSION_MAX_DEVICES;
 
   Serial.printf("\nScanning for sensors... Found %d device(s)\n", deviceCount);
 
@@ -397,254 +911,377 @@ void scanAndIdentifySensors() {
     return;
   }
 
-  // Get all sensor addresses
-  for (int i = 0; i < deviceCount && i < 16; i++) {
-    sensors.getAddress(allSensors[i], i);
+  commissioning = {};
+  commissioning.deviceCount = deviceCount;
+  for (int i = 0; i < deviceCount; i++) {
+    CommissionDevice& dev = commissioning.devices[i];
+    sensors.getAddress(dev.address, i);
+    dev.position = -1;
+    // Scan resolution; commissionFinish() puts the profile resolutions back
+    sensors.setResolution(dev.address, COMMISSION_RESOLUTION, true);
     Serial.printf("  Device %d: ", i);
-    printSensorAddress(allSensors[i]);
+    printSensorAddress(dev.address);
     Serial.println();
   }
 
-  // Get baseline temperatures
-  Serial.println("\nReading baseline temperatures...");
-  sensors.requestTemperatures();
-  delay(1000);
-
-  float baselines[16];
-  for (int i = 0; i < deviceCount && i < 16; i++) {
-    baselines[i] = sensors.getTempC(allSensors[i]);
-    Serial.printf("  Device %d baseline: %.2f°C\n", i, baselines[i]);
-  }
-
-  // Reset sensor count
-  activeSensorCount = 0;
-
-  // Identify AMBIENT sensor first (position 0)
-  Serial.println("\n========================================");
-  Serial.println("--- Identifying AMBIENT Sensor (Required) ---");
-  Serial.println("Touch/heat the AMBIENT sensor now...");
-  Serial.println("========================================");
-
-  // Single beep for ambient
-  playTone(1500, 150);
-  delay(500);
-
-  // Blink red LED while waiting
-  digitalWrite(LED_RED_PIN, HIGH);
+  // The engine owns the bus until it finishes - no sampling cycle meanwhile
+  conversion.pending = false;
 
-  int identifiedSensor = findSensorByTouch(allSensors, baselines, deviceCount);
+  unsigned long now = millis();
+  commissioning.active = true;
+  commissioning.scanWaitMs = sensors.millisToWaitForConversion(COMMISSION_RESOLUTION);
+  commissioning.startedAt = now;
+  commissioning.lastActivity = now;
+  commissionPrompt();
+  publishSnapshot(EVENT_COMMISSION);
+}
 
-  digitalWrite(LED_RED_PIN, LOW);
+/**
+ * Announce the position waiting for a sensor (log, web message, one beep per position)
+ */
+void commissionPrompt() {
+  uint8_t pos = commissioning.position;
+  if (pos == 0) {
+    snprintf(commissioning.message, sizeof(commissioning.message), "Touch the AMBIENT sensor");
+    playTone(1500, 150);
+  } else {
+    snprintf(commissioning.message, sizeof(commissioning.message),
+             "Touch the sensor for position %u (hold button 5s to save)", pos);
+    for (int i = 0; i < pos; i++) {
+      playTone(1500, 80);
+      delay(80);
+    }
+  }
+  logToSerial("Setup: %s", commissioning.message);
+  digitalWrite(LED_RED_PIN, HIGH);  // Red while waiting for a sensor
+}
 
-  if (identifiedSensor >= 0) {
-    memcpy(sensorConfig.sensors[0], allSensors[identifiedSensor], 8);
-    Serial.print("✓ AMBIENT sensor identified: ");
-    printSensorAddress(sensorConfig.sensors[0]);
-    Serial.println();
-    activeSensorCount = 1;
+/**
+ * One step of setup mode, called from loop() in place of the sampling cycle.
+ * Runs the scan conversions without blocking and watches the SAVE hold and
+ * the idle timeout, so web commands keep being applied in between
+ */
+void commissionUpdate() {
+  unsigned long now = millis();
 
-    // Success feedback
-    playTone(2000, 200);
-    blinkLED(LED_GREEN_PIN, 3, 100);
-    delay(1000);
+  // Hold BUTTON_SAVE_PRESS_MS to save; the hold that entered setup mode is ignored
+  if (digitalRead(BUTTON_PIN) == LOW) {
+    if (commissioning.buttonArmed) {
+      if (commissioning.buttonDownAt == 0) commissioning.buttonDownAt = now | 1;
+      bool on = (now - commissioning.buttonDownAt) % 200 < 100;
+      digitalWrite(LED_RED_PIN, on);
+      digitalWrite(LED_GREEN_PIN, on);
+      if (now - commissioning.buttonDownAt > BUTTON_SAVE_PRESS_MS) {
+        logToSerial("Setup: SAVE button pressed");
+        commissionFinish(true);
+        return;
+      }
+    }
   } else {
-    Serial.println("✗ ERROR: AMBIENT sensor is required!");
-    playTone(200, 1000);
-    blinkLED(LED_RED_PIN, 10, 200);
+    if (commissioning.buttonDownAt != 0) {
+      // Let go early - back to waiting for a sensor
+      digitalWrite(LED_GREEN_PIN, LOW);
+      digitalWrite(LED_RED_PIN, HIGH);
+    }
+    commissioning.buttonDownAt = 0;
+    commissioning.buttonArmed = true;
+  }
+
+  if (now - commissioning.lastActivity > COMMISSION_IDLE_TIMEOUT_MS) {
+    logToSerial("Setup: no sensor assigned for %lus", (unsigned long)(COMMISSION_IDLE_TIMEOUT_MS / 1000));
+    commissionFinish(true);  // Keeps what was assigned (needs ambient)
     return;
   }
 
-  // Now identify additional sensors (positions 1-9)
-  Serial.println("\n========================================");
-  Serial.println("--- Assigning Additional Sensors ---");
-  Serial.println("Touch each sensor to assign it");
-  Serial.println("OR press button for 5 seconds to SAVE");
-  Serial.println("========================================");
+  // A conversion every COMMISSION_SCAN_MS, read as soon as the sensors are done
+  if (!commissioning.scanPending) {
+    if (now - commissioning.scanStartedAt >= COMMISSION_SCAN_MS) {
+      sensors.requestTemperatures();
+      commissioning.scanPending = true;
+      commissioning.scanStartedAt = now;
+    }
+  } else if (now - commissioning.scanStartedAt >= commissioning.scanWaitMs ||
+             sensors.isConversionComplete()) {
+    commissioning.scanPending = false;
+    commissionScan(now);
+  }
+}
 
-  for (int pos = 1; pos < MAX_SENSOR_COUNT; pos++) {
-    Serial.printf("\n--- Position %d (optional) ---\n", pos);
-    Serial.println("Touch sensor to assign, or hold button 5s to save...");
+/**
+ * Read one scan and look for a touch.
+ *
+ * Each sensor's slope is a least-squares fit over its last COMMISSION_SLOPE_SCANS
+ * readings, less the bus-wide drift (median slope), so a change that moves every
+ * sensor together never reads as a touch. A touch must also lift the sensor
+ * COMMISSION_TOUCH_RISE_C above its smoothed baseline, hold for
+ * COMMISSION_CONFIRM_SCANS scans, and lead every other sensor by
+ * COMMISSION_LEAD_RATIO - with two warming at once, neither is assigned.
+ */
+void commissionScan(unsigned long now) {
+  Commissioning& c = commissioning;
+  uint8_t slot = c.recentHead;
+  c.scanAt[slot] = now;
+  c.recentHead = (slot + 1) % COMMISSION_SLOPE_SCANS;
+  if (c.recentCount < COMMISSION_SLOPE_SCANS) c.recentCount++;
+  c.scans++;
+
+  // Time axis of the fit, seconds relative to this scan
+  float x[COMMISSION_SLOPE_SCANS];
+  float meanX = 0;
+  for (int k = 0; k < c.recentCount; k++) {
+    x[k] = (long)(c.scanAt[k] - now) / 1000.0f;
+    meanX += x[k];
+  }
+  meanX /= c.recentCount;
+  float varX = 0;
+  for (int k = 0; k < c.recentCount; k++) {
+    varX += (x[k] - meanX) * (x[k] - meanX);
+  }
 
-    // Beep pattern to indicate position number
-    for (int i = 0; i < pos; i++) {
-      playTone(1500, 100);
-      delay(100);
+  float slopes[COMMISSION_MAX_DEVICES];
+  for (int i = 0; i < c.deviceCount; i++) {
+    CommissionDevice& dev = c.devices[i];
+    float t = sensors.getTempC(dev.address);
+
+    if (t == DEVICE_DISCONNECTED_C) {
+      // Missed read - start the history over once it answers again
+      dev.recentValid = false;
+      dev.risingScans = 0;
+      dev.slopeCPerS = 0;
+      slopes[i] = 0;
+      continue;
     }
-    delay(500);
 
-    // Wait for either sensor touch or button press
-    unsigned long waitStart = millis();
-    unsigned long timeout = 60000; // 60 second timeout
-    bool sensorFound = false;
-    bool buttonPressed = false;
-
-    digitalWrite(LED_RED_PIN, HIGH);
+    if (!dev.recentValid) {
+      // Flat history, so the first reading never looks like a jump
+      for (int k = 0; k < COMMISSION_SLOPE_SCANS; k++) dev.recent[k] = t;
+      dev.baselineC = t;
+      dev.recentValid = true;
+    }
+    dev.tempC = t;
+    dev.recent[slot] = t;
 
-    while (millis() - waitStart < timeout) {
-      // Check for button press (5 seconds to save)
-      if (digitalRead(BUTTON_PIN) == LOW) {
-        unsigned long pressStart = millis();
-        bool ledState = false;
-
-        while (digitalRead(BUTTON_PIN) == LOW && millis() - pressStart < BUTTON_SAVE_PRESS_MS + 500) {
-          // Blink both LEDs during save press
-          if ((millis() - pressStart) % 200 < 100) {
-            digitalWrite(LED_RED_PIN, HIGH);
-            digitalWrite(LED_GREEN_PIN, HIGH);
-          } else {
-            digitalWrite(LED_RED_PIN, LOW);
-            digitalWrite(LED_GREEN_PIN, LOW);
-          }
+    float meanY = 0;
+    for (int k = 0; k < c.recentCount; k++) meanY += dev.recent[k];
+    meanY /= c.recentCount;
+    float covXY = 0;
+    for (int k = 0; k < c.recentCount; k++) covXY += (x[k] - meanX) * (dev.recent[k] - meanY);
 
-          if (millis() - pressStart > BUTTON_SAVE_PRESS_MS) {
-            buttonPressed = true;
-            break;
-          }
-          delay(10);
-        }
+    dev.slopeCPerS = varX > 0 ? covXY / varX : 0;
+    slopes[i] = dev.slopeCPerS;
+  }
 
-        if (buttonPressed) {
-          break;
-        }
+  // Bus-wide drift: the median slope (of two sensors the slower, a lone sensor has none)
+  float drift = 0;
+  if (c.deviceCount >= 2) {
+    float sorted[COMMISSION_MAX_DEVICES];
+    memcpy(sorted, slopes, c.deviceCount * sizeof(float));
+    for (int i = 1; i < c.deviceCount; i++) {
+      float v = sorted[i];
+      int j = i - 1;
+      while (j >= 0 && sorted[j] > v) {
+        sorted[j + 1] = sorted[j];
+        j--;
       }
+      sorted[j + 1] = v;
+    }
+    drift = c.deviceCount >= 3 ? sorted[c.deviceCount / 2] : sorted[0];
+  }
 
-      // Check for sensor touch
-      sensors.requestTemperatures();
-      for (int i = 0; i < deviceCount && i < 16; i++) {
-        float currentTemp = sensors.getTempC(allSensors[i]);
-        float change = abs(currentTemp - baselines[i]);
-
-        if (change > TEMP_CHANGE_THRESHOLD) {
-          // Check if this sensor is already assigned
-          if (isDuplicateSensor(allSensors[i], pos)) {
-            Serial.println("✗ ERROR: This sensor is already assigned!");
-            Serial.print("   Detected sensor: ");
-            printSensorAddress(allSensors[i]);
-            Serial.println();
-            Serial.println("   Please touch a DIFFERENT sensor");
-
-            // Error feedback
-            playTone(400, 300);
-            delay(100);
-            playTone(400, 300);
-            blinkLED(LED_RED_PIN, 5, 150);
-
-            // Update baseline and continue waiting
-            baselines[i] = currentTemp;
-            delay(2000);
-            waitStart = millis(); // Reset timeout
-            continue;
-          }
+  float rel[COMMISSION_MAX_DEVICES];
+  int best = -1;
+  for (int i = 0; i < c.deviceCount; i++) {
+    CommissionDevice& dev = c.devices[i];
+    rel[i] = slopes[i] - drift;
 
-          // Valid sensor found
-          memcpy(sensorConfig.sensors[pos], allSensors[i], 8);
-          Serial.printf("✓ Position %d identified: ", pos);
-          printSensorAddress(sensorConfig.sensors[pos]);
-          Serial.println();
-
-          // Update baseline
-          baselines[i] = currentTemp;
-          activeSensorCount++;
-          sensorFound = true;
-
-          // Success feedback
-          digitalWrite(LED_RED_PIN, LOW);
-          playTone(2000, 200);
-          blinkLED(LED_GREEN_PIN, 3, 100);
-          delay(1000);
-          break;
-        }
-      }
+    if (!dev.recentValid) {
+      rel[i] = 0;
+      continue;
+    }
 
-      if (sensorFound || buttonPressed) {
-        break;
-      }
+    bool rising = rel[i] >= COMMISSION_TOUCH_SLOPE_C_PER_S;
+    if (rising && dev.tempC - dev.baselineC >= COMMISSION_TOUCH_RISE_C) {
+      if (dev.risingScans < 255) dev.risingScans++;
+    } else {
+      dev.risingScans = 0;
+    }
 
-      delay(500);
+    if (!rising) {
+      // Untouched: the baseline follows slow changes, and the next touch may count
+      dev.baselineC += COMMISSION_BASELINE_ALPHA * (dev.tempC - dev.baselineC);
+      dev.latched = false;
     }
 
-    digitalWrite(LED_RED_PIN, LOW);
-    digitalWrite(LED_GREEN_PIN, LOW);
+    if (dev.risingScans >= COMMISSION_CONFIRM_SCANS && !dev.latched &&
+        (best < 0 || rel[i] > rel[best])) {
+      best = i;
+    }
+  }
 
-    // If button was pressed to save, exit setup
-    if (buttonPressed) {
-      Serial.println("\n*** SAVE button pressed - finalizing setup ***");
-      break;
+  if (best >= 0) {
+    float runnerUp = 0;
+    for (int i = 0; i < c.deviceCount; i++) {
+      if (i != best && rel[i] > runnerUp) runnerUp = rel[i];
     }
 
-    // If timeout without finding sensor, ask to continue
-    if (!sensorFound) {
-      Serial.println("✗ Timeout - no sensor detected for this position");
-      Serial.printf("Current sensor count: %d (including ambient)\n", activeSensorCount);
-      break;
+    if (rel[best] >= COMMISSION_LEAD_RATIO * runnerUp) {
+      CommissionDevice& dev = c.devices[best];
+      dev.latched = true;
+      logToSerial("Setup: touch on device %d (+%.2f°C, %.2f°C/s over drift)",
+                  best, dev.tempC - dev.baselineC, rel[best]);
+      commissionAssign(best);
     }
   }
 
-  // Final validation
-  Serial.println("\nValidating configuration...");
-  if (!validateUniqueConfig()) {
-    Serial.println("✗ CRITICAL ERROR: Duplicate sensors detected!");
-    playTone(300, 1000);
-    blinkLED(LED_RED_PIN, 10, 200);
+  publishSnapshot(EVENT_COMMISSION);
+}
+
+/**
+ * Assign a sensor to the position being filled (from a touch or the web UI)
+ */
+void commissionAssign(int device) {
+  Commissioning& c = commissioning;
+  if (device < 0 || device >= c.deviceCount || c.position >= MAX_SENSOR_COUNT) return;
+
+  CommissionDevice& dev = c.devices[device];
+  if (dev.position >= 0) {
+    if (dev.position == 0) {
+      snprintf(c.message, sizeof(c.message), "Device %d is already AMBIENT - use a different one", device);
+    } else {
+      snprintf(c.message, sizeof(c.message), "Device %d is already position %d - use a different one",
+               device, dev.position);
+    }
+    logToSerial("Setup: ✗ %s", c.message);
+
+    // Error feedback
+    playTone(400, 150);
+    delay(80);
+    playTone(400, 150);
     return;
   }
-  Serial.println("✓ All sensors are unique");
 
-  // Save configuration
-  saveSensorConfig();
+  dev.position = c.position;
+  c.order[c.position] = device;
+  c.position++;
+  c.lastActivity = millis();
+
+  if (dev.position == 0) {
+    logToSerial("Setup: ✓ AMBIENT = device %d", device);
+  } else {
+    logToSerial("Setup: ✓ Position %d = device %d", dev.position, device);
+  }
 
   // Success feedback
-  Serial.printf("\nSetup complete! %d sensors configured\n", activeSensorCount);
-  playTone(1000, 100);
-  delay(50);
-  playTone(1500, 100);
-  delay(50);
-  playTone(2000, 300);
-  blinkLED(LED_GREEN_PIN, 5, 200);
+  digitalWrite(LED_RED_PIN, LOW);
+  playTone(2000, 150);
+  blinkLED(LED_GREEN_PIN, 1, 100);
 
-  sensorsConfigured = true;
+  if (c.position >= MAX_SENSOR_COUNT) {
+    commissionFinish(true);
+    return;
+  }
+  commissionPrompt();
+}
+
+/**
+ * Clear the last assigned position so it can be assigned again
+ */
+void commissionUndo() {
+  Commissioning& c = commissioning;
+  if (c.position == 0) return;
+
+  c.position--;
+  c.devices[c.order[c.position]].position = -1;
+  c.lastActivity = millis();
+  logToSerial("Setup: position %u cleared", c.position);
+  commissionPrompt();
 }
 
 /**
- * Find sensor by detecting temperature change (touch)
+ * Leave setup mode. With save, the assigned positions become the sensor
+ * configuration (ambient is required); otherwise the stored one is kept
  */
-int findSensorByTouch(DeviceAddress* allSensors, float* baselines, int count) {
-  unsigned long startTime = millis();
-  unsigned long timeout = 30000; // 30 second timeout
+void commissionFinish(bool save) {
+  Commissioning& c = commissioning;
+  c.active = false;
+  c.scanPending = false;
+  digitalWrite(LED_RED_PIN, LOW);
+  digitalWrite(LED_GREEN_PIN, LOW);
+
+  if (save && c.position == 0) {
+    snprintf(c.message, sizeof(c.message), "AMBIENT sensor is required - configuration unchanged");
+    logToSerial("Setup: ✗ %s", c.message);
+    playTone(200, 1000);
+    blinkLED(LED_RED_PIN, 10, 200);
+  } else if (save) {
+    for (int pos = 0; pos < c.position; pos++) {
+      memcpy(sensorConfig.sensors[pos], c.devices[c.order[pos]].address, 8);
+    }
+    activeSensorCount = c.position;
 
-  while (millis() - startTime < timeout) {
-    sensors.requestTemperatures();
+    if (!validateUniqueConfig()) {
+      // Cannot happen unless the bus search returned a device twice
+      snprintf(c.message, sizeof(c.message), "Duplicate sensors - configuration unchanged");
+      logToSerial("Setup: ✗ %s", c.message);
+      playTone(300, 1000);
+      blinkLED(LED_RED_PIN, 10, 200);
+      loadSensorConfig();
+    } else {
+      saveSensorConfig();
+      commitConfig();
 
-    for (int i = 0; i < count; i++) {
-      float currentTemp = sensors.getTempC(allSensors[i]);
-      float change = abs(currentTemp - baselines[i]);
+      snprintf(c.message, sizeof(c.message), "Saved %u sensors in %lus",
+               activeSensorCount, (millis() - c.startedAt) / 1000);
+      logToSerial("Setup: ✓ %s", c.message);
 
-      if (change > TEMP_CHANGE_THRESHOLD) {
-        Serial.printf("Temperature change detected on sensor %d: %.2f°C -> %.2f°C (Δ%.2f°C)\n",
-                     i, baselines[i], currentTemp, change);
+      // Success feedback
+      playTone(1000, 100);
+      delay(50);
+      playTone(1500, 100);
+      delay(50);
+      playTone(2000, 300);
+      blinkLED(LED_GREEN_PIN, 5, 200);
 
-        // Update baseline for next identification
-        baselines[i] = currentTemp;
-        return i;
-      }
+      sensorsConfigured = true;
+      memset(sensorHealth, 0, sizeof(sensorHealth));  // Counters belong to the old sensors
+      txPolicy.haveKeyframe = false;         // New sensor layout - RX needs a full frame
+      sampleSchedule.havePrevious = false;   // Sensors moved slots - previous trend no longer applies
     }
-
-    delay(500);
+  } else {
+    snprintf(c.message, sizeof(c.message), "Setup cancelled - configuration unchanged");
+    logToSerial("Setup: %s", c.message);
   }
 
-  return -1; // Timeout
+  // The scan ran every sensor at COMMISSION_RESOLUTION - back to the profile
+  memset(activeResolution, 0, sizeof(activeResolution));
+  applySensorResolutions();
+
+  publishSnapshot(EVENT_DATA | EVENT_COMMISSION);
 }
 
 /**
- * Check if a sensor address is already assigned to a previous position
+ * Apply a command posted to /api/commission - runs in loop(), which owns the bus
  */
-bool isDuplicateSensor(uint8_t* newAddr, int excludeIndex) {
-  for (int i = 0; i < excludeIndex && i < activeSensorCount; i++) {
-    if (memcmp(newAddr, sensorConfig.sensors[i], 8) == 0) {
-      return true; // Duplicate found
+void applyPendingCommission() {
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  CommissionRequest req = pendingCommission;
+  pendingCommission.command = 0;
+  xSemaphoreGive(stateMutex);
+
+  if (req.command == 0) return;
+
+  if (req.command == COMMISSION_CMD_START) {
+    if (!commissioning.active) enterSetupMode();
+  } else if (commissioning.active) {
+    switch (req.command) {
+      case COMMISSION_CMD_ASSIGN: commissionAssign(req.device); break;
+      case COMMISSION_CMD_UNDO:   commissionUndo(); break;
+      case COMMISSION_CMD_SAVE:   commissionFinish(true); break;
+      case COMMISSION_CMD_CANCEL: commissionFinish(false); break;
     }
   }
-  return false; // No duplicate
+
+  publishSnapshot(EVENT_COMMISSION);
 }
 
 /**
@@ -663,54 +1300,25 @@ bool validateUniqueConfig() {
 }
 
 /**
- * Save sensor configuration to EEPROM
+ * Stage sensor configuration (written by commitConfig)
  */
 void saveSensorConfig() {
-  Serial.println("Saving configuration to EEPROM...");
-
-  // Write magic number
-  uint16_t magic = EEPROM_MAGIC;
-  EEPROM.put(EEPROM_MAGIC_ADDR, magic);
-
-  // Write sensor configuration
-  EEPROM.put(EEPROM_SENSOR_ADDR, sensorConfig);
-
-  // Write active sensor count
-  EEPROM.put(EEPROM_SENSOR_COUNT_ADDR, activeSensorCount);
-
-  // Commit to flash - this is critical!
-  bool success = EEPROM.commit();
-  delay(100); // Give flash time to complete write
-
-  if (success) {
-    Serial.printf("Configuration saved: %d sensors\n", activeSensorCount);
-  } else {
-    Serial.println("ERROR: Failed to save configuration to EEPROM!");
-  }
-
-  // Verify the save by reading back magic number
-  uint16_t verifyMagic;
-  EEPROM.get(EEPROM_MAGIC_ADDR, verifyMagic);
-  if (verifyMagic != EEPROM_MAGIC) {
-    Serial.println("ERROR: EEPROM verification failed!");
-  } else {
-    Serial.println("EEPROM verification OK");
-  }
+  bool saved = true;
+  stageConfig(&storedConfig.sensorsSaved, &saved, sizeof(saved));
+  stageConfig(storedConfig.sensors, sensorConfig.sensors, sizeof(storedConfig.sensors));
+  stageConfig(&storedConfig.sensorCount, &activeSensorCount, sizeof(activeSensorCount));
+  Serial.printf("Configuration staged: %d sensors\n", activeSensorCount);
 }
 
 /**
- * Load sensor configuration from EEPROM
+ * Load sensor configuration from the config record
  */
 void loadSensorConfig() {
-  Serial.println("Loading configuration from EEPROM...");
-
-  uint16_t magic;
-  EEPROM.get(EEPROM_MAGIC_ADDR, magic);
-  Serial.printf("EEPROM magic number: 0x%04X (expected: 0x%04X)\n", magic, EEPROM_MAGIC);
+  Serial.println("Loading sensor configuration...");
 
-  if (magic == EEPROM_MAGIC) {
-    EEPROM.get(EEPROM_SENSOR_ADDR, sensorConfig);
-    EEPROM.get(EEPROM_SENSOR_COUNT_ADDR, activeSensorCount);
+  if (storedConfig.sensorsSaved) {
+    memcpy(sensorConfig.sensors, storedConfig.sensors, sizeof(sensorConfig.sensors));
+    activeSensorCount = storedConfig.sensorCount;
 
     // Validate sensor count
     if (activeSensorCount < 1 || activeSensorCount > MAX_SENSOR_COUNT) {
@@ -747,62 +1355,273 @@ void loadSensorConfig() {
 }
 
 /**
- * Read all sensors and transmit via LoRa
- * FORMAT: "TX<ID>:<pos1>,<pos2>,...,<pos9>,<ambient>"
- * Sends actual sensor values, fills remaining positions with 0.0
+ * Start a temperature conversion on all sensors without waiting for it
+ */
+void startConversion() {
+  sensors.requestTemperatures();
+  conversion.pending = true;
+  conversion.startedAt = millis();
+  conversion.startedUs = esp_timer_get_time();
+  conversion.waitMs = sensors.millisToWaitForConversion(conversionResolution);
+}
+
+/**
+ * True once a pending conversion has finished (sensors report done, or
+ * the worst-case time for the resolution has passed)
+ */
+bool conversionReady() {
+  if (!conversion.pending) return false;
+  if (millis() - conversion.startedAt >= conversion.waitMs) return true;
+  return sensors.isConversionComplete();
+}
+
+/**
+ * Light-sleep through the conversion window (deep sleep wake path only,
+ * nothing else needs the CPU meanwhile)
+ */
+void waitForConversionAsleep() {
+  unsigned long elapsed = millis() - conversion.startedAt;
+  if (elapsed < conversion.waitMs) {
+    Serial.flush();  // UART output is lost across light sleep
+    esp_sleep_enable_timer_wakeup((uint64_t)(conversion.waitMs - elapsed) * 1000ULL);
+    esp_light_sleep_start();
+  }
+
+  while (!conversionReady()) {
+    delay(1);
+  }
+}
+
+/**
+ * Read the completed conversion, transmit via LoRa and schedule the next cycle
  */
 void readAndTransmitData() {
+  int64_t cycleStarted = esp_timer_get_time();
+  perfRecord(PERF_CONVERSION, conversion.startedUs);
   logToSerial("--- Reading Sensors ---");
 
-  sensors.requestTemperatures();
+  conversion.pending = false;
 
   // Read all configured sensors
   // sensors[0] is ambient, sensors[1-9] are additional positions
+  int64_t readStarted = esp_timer_get_time();
   for (int i = 0; i < activeSensorCount; i++) {
-    latestData.temps[i] = sensors.getTempC(sensorConfig.sensors[i]);
+    latestData.centi[i] = readSensor(i);
+    latestData.temps[i] = centiValid(latestData.centi[i]) ? latestData.centi[i] / 100.0f : NAN;
   }
+  perfRecord(PERF_SENSOR_READ, readStarted);
 
-  // Get timestamp (milliseconds since boot)
-  unsigned long timestamp = millis() / 1000; // Convert to seconds
-  latestData.timestamp = timestamp;
+  // UTC seconds once an ACK has brought RX's time, seconds since boot until then
+  uint32_t utc = utcSeconds();
+  latestData.timestamp = utc ? utc : millis() / 1000;
+  latestData.utcSynced = utc != 0;
   latestData.valid = true;
 
-  // Format data packet with transmitter ID
-  // Format: TX<ID>:<pos1>,<pos2>,...,<pos9>,<ambient>
-  char packet[256];
-  int offset = snprintf(packet, sizeof(packet), "TX%d:", transmitterID);
+  // Build log message from the values that go on air
+  char dataLog[SERIAL_LOG_MESSAGE_LENGTH];
+  int pos = snprintf(dataLog, sizeof(dataLog), "Data: TX%d", transmitterID);
+  for (int i = 0; i < activeSensorCount && pos < (int)sizeof(dataLog); i++) {
+    char name[8];
+    if (i == 0) {
+      strcpy(name, "Ambient");
+    } else {
+      snprintf(name, sizeof(name), "Pos%d", i);
+    }
+    if (centiValid(latestData.centi[i])) {
+      pos += snprintf(dataLog + pos, sizeof(dataLog) - pos, " %s=%.2f°C", name, latestData.centi[i] / 100.0f);
+    } else {
+      pos += snprintf(dataLog + pos, sizeof(dataLog) - pos, " %s=ERR", name);
+    }
+  }
+  logToSerial("%s", dataLog);
+
+  // The scheduled interval is the time that passed since the previous cycle
+  txPolicy.msSinceKeyframe += sampleSchedule.intervalMs;
+
+  transmitReadings();
+  scheduleNextSample();
+  alignToSlot();
+  applySensorResolutions();
+  sampleHeap();
+  perfRecord(PERF_CYCLE, cycleStarted);
+
+  publishSnapshot(EVENT_DATA | EVENT_LORA);
+}
+
+/**
+ * Copy the state the web task reports into webSnapshot and flag `events` for push
+ */
+void publishSnapshot(uint8_t events) {
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  webSnapshot.data = latestData;
+  webSnapshot.sensorCount = activeSensorCount;
+  webSnapshot.sampleIntervalMs = sampleSchedule.intervalMs;
+  webSnapshot.lora = loraStats;
+  webSnapshot.storedReadings = history.count;
+  webSnapshot.undeliveredReadings = undeliveredReadings();
+  webSnapshot.power = powerControl;
+  webSnapshot.slotSynced = slotSynced();
+  webSnapshot.slot = webSnapshot.slotSynced ? slotSync.slot : transmitterID % SLOT_COUNT;
+  memcpy(webSnapshot.name, deviceName, sizeof(webSnapshot.name));
+  webSnapshot.transmitterID = transmitterID;
+  webSnapshot.powerSaveMode = powerSaveMode;
+  webSnapshot.resolution = resolutionProfile;
+  memcpy(webSnapshot.activeResolution, activeResolution, sizeof(webSnapshot.activeResolution));
+  memcpy(webSnapshot.health, sensorHealth, sizeof(webSnapshot.health));
+  memcpy(webSnapshot.perf, perfStages, sizeof(webSnapshot.perf));
+  webSnapshot.awake = awakeStats;
+
+  CommissionView& view = webSnapshot.commission;
+  view.active = commissioning.active;
+  view.deviceCount = commissioning.deviceCount;
+  view.position = commissioning.position;
+  view.scans = commissioning.scans;
+  view.elapsedMs = commissioning.active ? millis() - commissioning.startedAt : 0;
+  memcpy(view.message, commissioning.message, sizeof(view.message));
+  for (int i = 0; i < commissioning.deviceCount; i++) {
+    memcpy(view.devices[i].address, commissioning.devices[i].address, 8);
+    view.devices[i].tempC = commissioning.devices[i].tempC;
+    view.devices[i].slopeCPerS = commissioning.devices[i].slopeCPerS;
+    view.devices[i].position = commissioning.devices[i].position;
+  }
+  eventsPending |= events;
+  xSemaphoreGive(stateMutex);
+}
+
+/**
+ * Consistent copy of webSnapshot for a web handler
+ */
+WebSnapshot takeSnapshot() {
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  WebSnapshot snap = webSnapshot;
+  xSemaphoreGive(stateMutex);
+  return snap;
+}
+
+/**
+ * Apply settings posted to /api/config - runs in loop() so the OneWire bus,
+ * config store and transmit policy are only ever touched from the sampling side
+ */
+void applyPendingConfig() {
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  ConfigRequest req = pendingConfig;
+  pendingConfig = {};
+  xSemaphoreGive(stateMutex);
+
+  if (!req.pending) return;
+
+  if (req.hasName) {
+    strncpy(deviceName, req.name, MAX_DEVICE_NAME_LENGTH - 1);
+    deviceName[MAX_DEVICE_NAME_LENGTH - 1] = 0;
+    saveDeviceName();
+  }
+
+  if (req.hasTransmitterID) {
+    if (req.transmitterID != transmitterID) {
+      txPolicy.haveKeyframe = false; // RX has nothing for the new ID yet
+    }
+    transmitterID = req.transmitterID;
+  }
+
+  if (req.hasPowerSaveMode) {
+    powerSaveMode = req.powerSaveMode;
+  }
+
+  // Save transmitter config
+  saveTransmitterConfig();
 
-  // Add sensor values (positions 1-9, then ambient)
-  // Format: pos1, pos2, ..., pos9, ambient
-  for (int i = 1; i < activeSensorCount; i++) {
-    offset += snprintf(packet + offset, sizeof(packet) - offset, "%.1f,", latestData.temps[i]);
+  bool profileChanged = false;
+  for (int i = 0; i < MAX_SENSOR_COUNT; i++) {
+    if (req.resolutions[i] != 0) {
+      resolutionProfile.bits[i] = req.resolutions[i];
+      profileChanged = true;
+    }
+  }
+
+  if (req.hasAutoResolution) {
+    resolutionProfile.autoEscalate = req.autoResolution;
+    profileChanged = true;
   }
 
-  // Fill remaining positions with 0.0
-  for (int i = activeSensorCount; i < MAX_SENSOR_COUNT; i++) {
-    offset += snprintf(packet + offset, sizeof(packet) - offset, "0.0,");
+  if (profileChanged) {
+    saveResolutionProfile();
+    applySensorResolutions();
   }
 
-  // Add ambient (last value, no comma)
-  snprintf(packet + offset, sizeof(packet) - offset, "%.1f", latestData.temps[0]);
+  // One flash write for the whole request, none if nothing changed
+  commitConfig();
+
+  publishSnapshot(0);
+}
+
+/**
+ * Transmit latestData
+ * FORMAT: binary frame (see FRAME_* definitions)
+ * Sends a keyframe at least every KEYFRAME_INTERVAL_MS; in between, only sensors
+ * that moved more than DELTA_THRESHOLD_C are sent, and nothing at all if none did
+ */
+void transmitReadings() {
+  cycleTxAtMs = txClockMs();
+
+  bool keyframe = !txPolicy.haveKeyframe ||
+                  txPolicy.keyframeSensorCount != activeSensorCount ||
+                  txPolicy.msSinceKeyframe >= KEYFRAME_INTERVAL_MS;
+
+  uint16_t mask = 0;
+  const int16_t thresholdCenti = (int16_t)(DELTA_THRESHOLD_C * 100);
+  for (int i = 0; i < activeSensorCount; i++) {
+    int16_t centi = latestData.centi[i];
+    if (keyframe || abs(centi - txPolicy.lastSentCenti[i]) > thresholdCenti) {
+      mask |= (1 << i);
+    }
+  }
 
-  // Build log message
-  String dataLog = "Data: TX" + String(transmitterID) + " Ambient=" + String(latestData.temps[0], 2) + "°C";
-  for (int i = 1; i < activeSensorCount; i++) {
-    dataLog += " Pos" + String(i) + "=" + String(latestData.temps[i], 2) + "°C";
+  if (mask == 0) {
+    loraStats.suppressedCycles++;
+    logToSerial("No change above threshold - transmission skipped");
+    return;
   }
-  logToSerial(dataLog);
+
+  uint8_t frame[FRAME_MAX_SIZE];
+  int64_t buildStarted = esp_timer_get_time();
+  size_t frameLen = buildFrame(frame, keyframe ? FRAME_TYPE_READINGS : FRAME_TYPE_DELTA, mask);
+  perfRecord(PERF_FRAME_BUILD, buildStarted);
 
   // Transmit via LoRa
-  logToSerial("Transmitting: " + String(packet));
+  logToSerial("Transmitting %s: seq %u, %u bytes",
+              keyframe ? "keyframe" : "delta", frame[4], (unsigned)frameLen);
 
   digitalWrite(LED_GREEN_PIN, HIGH);
+  sendFrame(frame, frameLen);
+  digitalWrite(LED_GREEN_PIN, LOW);
 
-  LoRa.beginPacket();
-  LoRa.print(packet);
-  LoRa.endPacket();
+  storeReading(frame[4]);
+  bool acked = awaitAck(frame[4]);
+  if (acked) {
+    backfillHistory();
 
-  digitalWrite(LED_GREEN_PIN, LOW);
+    // Remember what RX now holds so deltas are measured against it
+    for (int i = 0; i < activeSensorCount; i++) {
+      if (mask & (1 << i)) {
+        txPolicy.lastSentCenti[i] = latestData.centi[i];
+      }
+    }
+  }
+
+  if (keyframe) {
+    txPolicy.haveKeyframe = true;
+    txPolicy.keyframeSensorCount = activeSensorCount;
+    txPolicy.msSinceKeyframe = 0;
+    loraStats.keyframes++;
+  } else {
+    loraStats.deltaFrames++;
+  }
+
+  // RX may not hold this frame's values, so deltas against them could leave a
+  // stale reading there until the next scheduled keyframe - resend everything
+  if (!acked) {
+    txPolicy.haveKeyframe = false;
+  }
 
   // Update LoRa statistics
   loraStats.totalPackets++;
@@ -812,15 +1631,587 @@ void readAndTransmitData() {
 }
 
 /**
- * Print sensor address in hex format
+ * Pick the interval to the next sample from the hubs' thermal trend
+ * - delta-over-ambient rising: shorten, so each sample sees a similar temperature step
+ * - hub running hot: never slower than SAMPLE_INTERVAL_HOT_MS
+ * - everything stable near ambient: double the interval up to SAMPLE_INTERVAL_MAX_MS
+ * - otherwise: SAMPLE_INTERVAL_BASE_MS
  */
-void printSensorAddress(uint8_t* addr) {
-  for (int i = 0; i < 8; i++) {
-    if (addr[i] < 16) Serial.print("0");
-    Serial.print(addr[i], HEX);
-    if (i < 7) Serial.print(":");
-  }
-}
+void scheduleNextSample() {
+  unsigned long previousInterval = sampleSchedule.intervalMs;
+  unsigned long next = SAMPLE_INTERVAL_BASE_MS;
+
+  if (sampleSchedule.havePrevious && sampleSchedule.previousCount == activeSensorCount) {
+    float minutes = previousInterval / 60000.0f;
+    float ambient = latestData.temps[0];
+    float previousAmbient = sampleSchedule.previousCenti[0] / 100.0f;
+    float maxRise = 0;   // °C/min, fastest-rising hub delta-over-ambient
+    float maxDelta = 0;  // °C, hottest hub above ambient
+
+    // A slot without a reading, now or last cycle, has no trend
+    bool ambientValid = centiValid(latestData.centi[0]) && centiValid(sampleSchedule.previousCenti[0]);
+    for (int i = 1; i < activeSensorCount && ambientValid; i++) {
+      if (!centiValid(latestData.centi[i]) || !centiValid(sampleSchedule.previousCenti[i])) continue;
+      float delta = latestData.temps[i] - ambient;
+      float previousDelta = sampleSchedule.previousCenti[i] / 100.0f - previousAmbient;
+      float rise = (delta - previousDelta) / minutes;
+      if (rise > maxRise) maxRise = rise;
+      if (delta > maxDelta) maxDelta = delta;
+    }
+
+    if (maxRise > TREND_STABLE_C_PER_MIN) {
+      next = (unsigned long)(SAMPLE_INTERVAL_BASE_MS * (TREND_RISE_REF_C_PER_MIN / maxRise));
+      next = min(next, (unsigned long)SAMPLE_INTERVAL_BASE_MS);
+    } else if (maxDelta < TREND_STABLE_DELTA_C) {
+      next = max(previousInterval * 2, (unsigned long)SAMPLE_INTERVAL_BASE_MS);
+    }
+
+    if (maxDelta >= TREND_HOT_DELTA_C) {
+      next = min(next, (unsigned long)SAMPLE_INTERVAL_HOT_MS);
+    }
+  }
+
+  next = constrain(next, (unsigned long)SAMPLE_INTERVAL_MIN_MS, (unsigned long)SAMPLE_INTERVAL_MAX_MS);
+
+  // Do not sleep past the keyframe deadline announced to RX
+  if (txPolicy.msSinceKeyframe < KEYFRAME_INTERVAL_MS) {
+    unsigned long untilKeyframe = KEYFRAME_INTERVAL_MS - txPolicy.msSinceKeyframe;
+    next = max(min(next, untilKeyframe), (unsigned long)SAMPLE_INTERVAL_MIN_MS);
+  }
+
+  sampleSchedule.intervalMs = next;
+  sampleSchedule.havePrevious = true;
+  sampleSchedule.previousCount = activeSensorCount;
+  for (int i = 0; i < activeSensorCount; i++) {
+    sampleSchedule.previousCenti[i] = latestData.centi[i];
+  }
+
+  if (next != previousInterval) {
+    logToSerial("Sample interval: %.1fs -> %.1fs", previousInterval / 1000.0f, next / 1000.0f);
+  }
+}
+
+/**
+ * Encode the masked slots of latestData as a binary frame
+ * Returns the frame length in bytes
+ */
+size_t buildFrame(uint8_t* frame, uint8_t type, uint16_t mask) {
+  size_t len = writeFrameHeader(frame, type, mask);
+  for (int i = 0; i < MAX_SENSOR_COUNT; i++) {
+    if (mask & (1 << i)) {
+      len = frameAppendCenti(frame, len, latestData.centi[i]);
+    }
+  }
+  return frameFinish(frame, len);
+}
+
+/**
+ * Write the common frame header, consuming the next sequence number
+ * Returns the header length
+ */
+size_t writeFrameHeader(uint8_t* frame, uint8_t type, uint16_t mask) {
+  // Longest RX may wait for the next frame: a whole keyframe period
+  unsigned long maxSilenceS = KEYFRAME_INTERVAL_MS / 1000;
+
+  return frameWriteHeader(frame, type, transmitterID, frameSequence++,
+                          (uint8_t)min((maxSilenceS + 9) / 10, 255UL), mask);
+}
+
+/**
+ * TX clock in seconds since power-on
+ * Unlike millis(), the RTC keeps this running through deep sleep
+ */
+uint32_t txClockSeconds() {
+  return (uint32_t)time(nullptr);
+}
+
+/**
+ * Add latestData to the store-and-forward history as carried by live frame `sequence`
+ */
+void storeReading(uint8_t sequence) {
+  // Readings with a different sensor layout cannot share a BATCH frame mask
+  if (history.sensorCount != activeSensorCount) {
+    history.head = 0;
+    history.count = 0;
+    history.sensorCount = activeSensorCount;
+  }
+
+  StoredReading* r = &history.readings[history.head];
+  r->takenAt = txClockSeconds();
+  r->sequence = sequence;
+  r->lastFrame = sequence;
+  r->delivered = false;
+  for (int i = 0; i < activeSensorCount; i++) {
+    r->centi[i] = latestData.centi[i];
+  }
+
+  history.head = (history.head + 1) % READING_HISTORY_SIZE;
+  if (history.count < READING_HISTORY_SIZE) {
+    history.count++;
+  }
+}
+
+/**
+ * RX confirmed frame `frameSeq` - every reading it carried is delivered
+ */
+void markFrameDelivered(uint8_t frameSeq) {
+  int start = (history.head - history.count + READING_HISTORY_SIZE) % READING_HISTORY_SIZE;
+  for (int i = 0; i < history.count; i++) {
+    StoredReading* r = &history.readings[(start + i) % READING_HISTORY_SIZE];
+    if (!r->delivered && r->lastFrame == frameSeq) {
+      r->delivered = true;
+    }
+  }
+}
+
+int undeliveredReadings() {
+  int pending = 0;
+  int start = (history.head - history.count + READING_HISTORY_SIZE) % READING_HISTORY_SIZE;
+  for (int i = 0; i < history.count; i++) {
+    if (!history.readings[(start + i) % READING_HISTORY_SIZE].delivered) pending++;
+  }
+  return pending;
+}
+
+/**
+ * Re-send up to BATCH_MAX_READINGS undelivered readings, oldest first, in one
+ * BATCH frame. Ages are relative to now, so RX needs no shared clock to
+ * recover the original time. Returns the number of readings sent and the
+ * frame's sequence in `sequence`
+ */
+int transmitBackfill(uint8_t* sequence) {
+  uint8_t frame[BATCH_FRAME_MAX_SIZE];
+  uint16_t mask = (1 << history.sensorCount) - 1;
+  size_t len = writeFrameHeader(frame, FRAME_TYPE_BATCH, mask);
+  uint8_t batchSeq = frame[4];
+  size_t countPos = len++;
+  uint8_t packed = 0;
+  uint32_t now = txClockSeconds();
+
+  int start = (history.head - history.count + READING_HISTORY_SIZE) % READING_HISTORY_SIZE;
+  for (int i = 0; i < history.count && packed < BATCH_MAX_READINGS; i++) {
+    StoredReading* r = &history.readings[(start + i) % READING_HISTORY_SIZE];
+    if (r->delivered) continue;
+
+    uint32_t age = min(now - r->takenAt, (uint32_t)0xFFFF);
+    frame[len++] = r->sequence;
+    frame[len++] = age & 0xFF;
+    frame[len++] = age >> 8;
+    for (int s = 0; s < history.sensorCount; s++) {
+      len = frameAppendCenti(frame, len, r->centi[s]);
+    }
+    r->lastFrame = batchSeq;
+    packed++;
+  }
+
+  if (packed == 0) {
+    frameSequence--;  // Nothing sent - give the sequence number back
+    return 0;
+  }
+
+  frame[countPos] = packed;
+  len = frameFinish(frame, len);
+  *sequence = batchSeq;
+
+  logToSerial("Backfilling %u readings: seq %u, %u bytes", packed, batchSeq, (unsigned)len);
+
+  sendFrame(frame, len);
+
+  loraStats.totalPackets++;
+  loraStats.backfillFrames++;
+  return packed;
+}
+
+/**
+ * The link just acknowledged a live frame - send what RX missed while it was
+ * out of range, stopping as soon as a batch goes unacknowledged
+ */
+void backfillHistory() {
+  for (int i = 0; i < BACKFILL_BATCHES_PER_CYCLE && undeliveredReadings() > 0; i++) {
+    uint8_t sequence;
+    if (transmitBackfill(&sequence) == 0 || !awaitAck(sequence)) {
+      return;
+    }
+  }
+}
+
+/**
+ * Listen for RX's ACK of frame `sequence` for up to ACK_WINDOW_MS
+ * On success the readings that frame carried are marked delivered and the
+ * link quality reported by both ends is recorded
+ */
+bool awaitAck(uint8_t sequence) {
+  if (ACK_WINDOW_MS == 0) return false;
+
+  loraStats.acksExpected++;
+  unsigned long start = millis();
+  int64_t startedUs = esp_timer_get_time();
+
+  while (millis() - start < ACK_WINDOW_MS) {
+    int size = LoRa.parsePacket();  // (Re)arms single receive while nothing is pending
+    if (size == 0) {
+      delay(1);
+      continue;
+    }
+
+    uint8_t ack[ACK_FRAME_SIZE];
+    int len = 0;
+    while (LoRa.available()) {
+      uint8_t b = LoRa.read();
+      if (len < ACK_FRAME_SIZE) ack[len] = b;
+      len++;
+    }
+    uint64_t receivedAt = txClockMs();
+
+    // Anything else on the channel (another TX's uplink, a corrupted ACK) is ignored
+    if ((len != ACK_FRAME_SIZE && len != ACK_FRAME_SIZE_V2 && len != ACK_FRAME_SIZE_V1) ||
+        ack[0] != FRAME_MAGIC ||
+        (ack[1] & 0x0F) != FRAME_TYPE_ACK ||
+        (ack[2] | (ack[3] << 8)) != transmitterID ||
+        ack[4] != sequence ||
+        !frameCrcValid(ack, len)) {
+      continue;
+    }
+
+    uint16_t airtime = (len == ACK_FRAME_SIZE) ? ACK_AIRTIME_MS : ACK_AIRTIME_MS_V2;
+    if (len >= ACK_FRAME_SIZE_V2 && ack[7] < SLOT_COUNT) {
+      // RX's frame phase was (reported + airtime) when the ACK arrived here
+      uint16_t rxPhase = ack[8] | (ack[9] << 8);
+      uint32_t sinceOrigin = (rxPhase + airtime) % SLOT_FRAME_MS;
+      slotSync.frameOriginMs = (receivedAt + SLOT_FRAME_MS - sinceOrigin) % SLOT_FRAME_MS;
+      slotSync.slot = ack[7];
+      slotSync.syncedAtMs = receivedAt;
+      slotSync.synced = true;
+    } else if (len >= ACK_FRAME_SIZE_V2) {
+      // Every slot is taken (or RX restarted): back to jitter so we do not sit on someone else's
+      slotSync.synced = false;
+    }
+
+    uint32_t rxUtcSeconds = (len == ACK_FRAME_SIZE)
+        ? ack[10] | (ack[11] << 8) | ((uint32_t)ack[12] << 16) | ((uint32_t)ack[13] << 24) : 0;
+    if (rxUtcSeconds != 0) {
+      // RX's UTC is (reported + airtime) on arrival, same as the phase
+      uint64_t rxUtcMs = rxUtcSeconds * 1000ULL + (ack[14] | (ack[15] << 8)) + airtime;
+      utcSync.offsetMs = (int64_t)rxUtcMs - (int64_t)receivedAt;
+      utcSync.syncedAtMs = receivedAt;
+      utcSync.synced = true;
+    }
+
+    loraStats.rssi = LoRa.packetRssi();
+    loraStats.snr = LoRa.packetSnr();
+    loraStats.uplinkRssi = (int8_t)ack[5];
+    loraStats.uplinkSnr = (int8_t)ack[6] / 4.0;
+    loraStats.acksReceived++;
+    LoRa.idle();
+    perfRecord(PERF_ACK_WAIT, startedUs);
+
+    markFrameDelivered(sequence);
+    logToSerial("ACK seq %u: uplink %d dBm / %.1f dB SNR",
+                sequence, loraStats.uplinkRssi, loraStats.uplinkSnr);
+    updateTxPower(true);
+    return true;
+  }
+
+  LoRa.idle();
+  perfRecord(PERF_ACK_WAIT, startedUs);
+  logToSerial("No ACK for seq %u", sequence);
+  updateTxPower(false);
+  return false;
+}
+
+/**
+ * Listen-before-talk, then transmit
+ * Backs off a random time while another transmitter is on air, and sends
+ * anyway after LBT_MAX_ATTEMPTS rather than dropping the frame
+ */
+void sendFrame(const uint8_t* frame, size_t len) {
+  int attempt = 0;
+  while (channelBusy()) {
+    if (++attempt >= LBT_MAX_ATTEMPTS) {
+      loraStats.lbtForced++;
+      break;
+    }
+    loraStats.lbtBackoffs++;
+    delay(random(LBT_BACKOFF_MIN_MS, LBT_BACKOFF_MAX_MS));
+  }
+
+  int64_t started = esp_timer_get_time();
+  LoRa.beginPacket();
+  LoRa.write(frame, len);
+  LoRa.endPacket();
+  perfRecord(PERF_AIRTIME, started);
+}
+
+/**
+ * Run one channel activity detection; a CAD that never completes counts as clear
+ */
+bool channelBusy() {
+  cadDone = false;
+  LoRa.channelActivityDetection();
+
+  unsigned long start = millis();
+  while (!cadDone && millis() - start < LBT_CAD_TIMEOUT_MS) {
+    delay(1);
+  }
+  return cadDone && cadDetected;
+}
+
+// Called from the LoRa library's DIO0 interrupt handler
+void IRAM_ATTR onCadDone(bool detected) {
+  cadDetected = detected;
+  cadDone = true;
+}
+
+/**
+ * Stretch the scheduled interval so the next frame starts on our slot
+ * Intervals shorter than a slot frame (hot hubs) are kept as they are -
+ * sample rate wins over collision avoidance there - and only get the jitter
+ */
+void alignToSlot() {
+  bool synced = slotSynced();
+
+  if (sampleSchedule.intervalMs >= SLOT_FRAME_MS) {
+    uint8_t slot = synced ? slotSync.slot : transmitterID % SLOT_COUNT;
+    uint32_t origin = synced ? slotSync.frameOriginMs : 0;
+    uint32_t slotPhase = (origin + slot * SLOT_LENGTH_MS) % SLOT_FRAME_MS;
+    uint32_t nextPhase = (cycleTxAtMs + sampleSchedule.intervalMs) % SLOT_FRAME_MS;
+    sampleSchedule.intervalMs += (slotPhase + SLOT_FRAME_MS - nextPhase) % SLOT_FRAME_MS;
+  }
+
+  if (!synced) {
+    sampleSchedule.intervalMs += random(0, SLOT_JITTER_MS);
+  }
+}
+
+bool slotSynced() {
+  return slotSync.synced && txClockMs() - slotSync.syncedAtMs <= SLOT_SYNC_MAX_AGE_MS;
+}
+
+/**
+ * UTC seconds from the last ACK that carried RX's time, 0 until one has
+ * Kept on txClockMs(), so it also runs on through deep sleep
+ */
+uint32_t utcSeconds() {
+  if (!utcSync.synced) return 0;
+  return (uint32_t)(((int64_t)txClockMs() + utcSync.offsetMs) / 1000);
+}
+
+/**
+ * Millisecond TX clock; like txClockSeconds() it keeps running through deep sleep
+ */
+uint64_t txClockMs() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (uint64_t)tv.tv_sec * 1000ULL + tv.tv_usec / 1000;
+}
+
+/**
+ * ADR step after each ACK window
+ * - margin above target (averaged over ADR_MIN_SAMPLES ACKs): step power down
+ * - margin below target: step power up straight away
+ * - ADR_MISSED_ACKS windows in a row without ACK: step power up
+ */
+void updateTxPower(bool acked) {
+  if (!ENABLE_ADR) return;
+
+  if (!acked) {
+    if (++powerControl.missedAcks >= ADR_MISSED_ACKS) {
+      powerControl.missedAcks = 0;
+      setTxPower(powerControl.txPowerDbm + ADR_STEP_DB);
+    }
+    return;
+  }
+
+  float margin = loraStats.uplinkSnr - LORA_SNR_FLOOR_DB;
+  powerControl.missedAcks = 0;
+  powerControl.marginAvgDb = (powerControl.samples == 0)
+                           ? margin
+                           : 0.75 * powerControl.marginAvgDb + 0.25 * margin;
+  powerControl.samples++;
+
+  if (margin < ADR_TARGET_MARGIN_DB) {
+    setTxPower(powerControl.txPowerDbm + ADR_STEP_DB);
+  } else if (powerControl.samples >= ADR_MIN_SAMPLES &&
+             powerControl.marginAvgDb >= ADR_TARGET_MARGIN_DB + ADR_STEP_DB) {
+    setTxPower(powerControl.txPowerDbm - ADR_STEP_DB);
+  }
+}
+
+/**
+ * Apply a new TX power, clamped to the PA_BOOST range; restarts the margin average
+ */
+void setTxPower(int8_t dbm) {
+  dbm = constrain(dbm, ADR_MIN_TX_POWER, LORA_TX_POWER);
+  if (dbm == powerControl.txPowerDbm) return;
+
+  logToSerial("ADR: TX power %d -> %d dBm", powerControl.txPowerDbm, dbm);
+  powerControl.txPowerDbm = dbm;
+  powerControl.samples = 0;
+  powerControl.powerChanges++;
+  LoRa.setTxPower(dbm);
+}
+
+/**
+ * Convert a temperature to the frame's int16 centi-degree encoding
+ */
+int16_t toCenti(float tempC) {
+  return (int16_t)lroundf(tempC * 100.0f);
+}
+
+/**
+ * True for a temperature, false for FRAME_CENTI_INVALID
+ */
+bool centiValid(int16_t centi) {
+  return centi != FRAME_CENTI_INVALID;
+}
+
+/**
+ * Read one configured sensor's finished conversion, counting every failure in
+ * sensorHealth. A failed read is retried up to SENSOR_READ_RETRIES times in
+ * this cycle only; a sensor that browned out (85.00°C power-on value) gets one
+ * fresh conversion of its own first. Returns centi-degrees, or FRAME_CENTI_INVALID
+ */
+int16_t readSensor(int index) {
+  SensorHealth& health = sensorHealth[index];
+  const uint8_t* address = sensorConfig.sensors[index];
+  unsigned long busUs = 0;
+  int16_t centi = FRAME_CENTI_INVALID;
+  uint8_t result = SENSOR_DISCONNECTED;
+
+  health.reads++;
+  for (int attempt = 0; attempt <= SENSOR_READ_RETRIES; attempt++) {
+    if (attempt > 0) health.retries++;
+
+    unsigned long started = micros();
+    result = readScratchpadCenti(address, &centi);
+    busUs += micros() - started;
+
+    // Exactly 85.00°C straight after a much cooler reading is the reset value, not heat
+    if (result == SENSOR_OK && centi == SENSOR_POR_CENTI &&
+        !(health.haveGood && fabsf((health.lastGoodCenti - SENSOR_POR_CENTI) / 100.0f) <= SENSOR_POR_PLAUSIBLE_C)) {
+      result = SENSOR_POWER_ON;
+    }
+
+    if (result == SENSOR_OK) break;
+
+    if (result == SENSOR_CRC_ERROR) {
+      health.crcErrors++;
+    } else if (result == SENSOR_DISCONNECTED) {
+      health.disconnects++;
+    } else {
+      health.powerOnResets++;
+      // The reset lost the conversion (and the resolution) - run one for this sensor
+      if (attempt < SENSOR_READ_RETRIES) {
+        sensors.setResolution(address, activeResolution[index] ? activeResolution[index] : TEMP_PRECISION);
+        sensors.requestTemperaturesByAddress(address);
+        delay(sensors.millisToWaitForConversion(activeResolution[index] ? activeResolution[index] : TEMP_PRECISION));
+      }
+    }
+  }
+
+  health.lastReadUs = (uint16_t)min(busUs, 65535UL);
+  if (health.lastReadUs > health.maxReadUs) health.maxReadUs = health.lastReadUs;
+
+  if (result != SENSOR_OK) {
+    health.invalid++;
+    logToSerial("Sensor %d unreadable (%s) - sent as invalid", index,
+                result == SENSOR_CRC_ERROR ? "CRC error" :
+                result == SENSOR_DISCONNECTED ? "disconnected" : "power-on reset");
+    return FRAME_CENTI_INVALID;
+  }
+
+  health.haveGood = true;
+  health.lastGoodCenti = centi;
+  return centi;
+}
+
+/**
+ * Read a DS18B20 scratchpad and classify it (SENSOR_*)
+ * Scratchpad: [0-1] temperature (LE, 1/16 °C)  [4] configuration (resolution
+ * in bits 5-6)  [8] CRC-8 over [0-7]. Bits below the resolution are undefined
+ */
+uint8_t readScratchpadCenti(const uint8_t* address, int16_t* centi) {
+  uint8_t scratch[9];
+  if (!sensors.readScratchPad(address, scratch)) {
+    return SENSOR_DISCONNECTED;  // No presence pulse
+  }
+
+  bool allZero = true;
+  bool allOnes = true;
+  for (int i = 0; i < 9; i++) {
+    if (scratch[i] != 0x00) allZero = false;
+    if (scratch[i] != 0xFF) allOnes = false;
+  }
+  if (allZero || allOnes) {
+    return SENSOR_DISCONNECTED;  // Bus held low, or nothing driving it
+  }
+
+  if (OneWire::crc8(scratch, 8) != scratch[8]) {
+    return SENSOR_CRC_ERROR;
+  }
+
+  int16_t raw = (int16_t)((scratch[1] << 8) | scratch[0]);
+  uint8_t bits = ((scratch[4] >> 5) & 0x03) + 9;
+  raw &= ~((1 << (12 - bits)) - 1);
+  *centi = toCenti(raw / 16.0f);
+  return SENSOR_OK;
+}
+
+/**
+ * Program each configured sensor with the resolution its profile asks for
+ * With autoEscalate, a hub within reach of the warn threshold runs at
+ * TEMP_PRECISION until it cools RESOLUTION_HYSTERESIS_C below it again.
+ * Uses the last sample kept by the scheduler, so it also works straight after a wake
+ */
+void applySensorResolutions() {
+  uint8_t highest = TEMP_PRECISION_MIN;
+  bool haveSample = sampleSchedule.havePrevious && sampleSchedule.previousCount == activeSensorCount;
+
+  for (int i = 0; i < activeSensorCount; i++) {
+    bool sampleValid = haveSample && centiValid(sampleSchedule.previousCenti[i]) &&
+                       centiValid(sampleSchedule.previousCenti[0]);
+    if (resolutionProfile.autoEscalate && i > 0 && haveSample && !sampleValid) {
+      // No reading to judge by - keep the current resolution
+    } else if (resolutionProfile.autoEscalate && i > 0 && haveSample) {
+      float delta = (sampleSchedule.previousCenti[i] - sampleSchedule.previousCenti[0]) / 100.0f;
+      float threshold = resolutionEscalated[i] ? RESOLUTION_ESCALATE_DELTA_C - RESOLUTION_HYSTERESIS_C
+                                               : RESOLUTION_ESCALATE_DELTA_C;
+      resolutionEscalated[i] = (delta >= threshold);
+    } else {
+      resolutionEscalated[i] = false;
+    }
+
+    uint8_t target = resolutionEscalated[i] ? TEMP_PRECISION : resolutionProfile.bits[i];
+
+    if (target != activeResolution[i]) {
+      // Library skips the bus write if the sensor already has this resolution
+      if (sensors.setResolution(sensorConfig.sensors[i], target, true)) {
+        if (activeResolution[i] != 0) {
+          logToSerial("Sensor %d resolution: %u -> %u bit", i, activeResolution[i], target);
+        }
+        activeResolution[i] = target;
+      } else {
+        activeResolution[i] = 0;  // Retry next cycle
+        target = TEMP_PRECISION;  // Unknown state - allow for the slowest conversion
+      }
+    }
+
+    if (target > highest) highest = target;
+  }
+
+  conversionResolution = highest;
+}
+
+/**
+ * Print sensor address in hex format
+ */
+void printSensorAddress(uint8_t* addr) {
+  for (int i = 0; i < 8; i++) {
+    if (addr[i] < 16) Serial.print("0");
+    Serial.print(addr[i], HEX);
+    if (i < 7) Serial.print(":");
+  }
+}
 
 /**
  * Play a tone on the buzzer
@@ -851,21 +2242,21 @@ void blinkLED(int pin, int times, int delayMs) {
 }
 
 /**
- * Save device name to EEPROM
+ * Stage device name (written by commitConfig)
  */
 void saveDeviceName() {
-  EEPROM.put(EEPROM_NAME_ADDR, deviceName);
-  bool success = EEPROM.commit();
-  delay(50); // Give flash time to complete write
-  Serial.printf("Device name saved to EEPROM: %s\n", success ? "OK" : "FAILED");
+  char name[MAX_DEVICE_NAME_LENGTH] = {0};
+  strncpy(name, deviceName, MAX_DEVICE_NAME_LENGTH - 1);
+  stageConfig(storedConfig.name, name, sizeof(name));
 }
 
 /**
- * Load device name from EEPROM
+ * Load device name from the config record
  */
 void loadDeviceName() {
   char tempName[MAX_DEVICE_NAME_LENGTH];
-  EEPROM.get(EEPROM_NAME_ADDR, tempName);
+  memcpy(tempName, storedConfig.name, sizeof(tempName));
+  tempName[MAX_DEVICE_NAME_LENGTH - 1] = 0;
 
   // Check if name is valid (printable characters)
   bool valid = true;
@@ -885,38 +2276,31 @@ void loadDeviceName() {
     deviceName[MAX_DEVICE_NAME_LENGTH - 1] = 0;
     Serial.printf("Loaded device name: %s\n", deviceName);
   } else {
-    Serial.println("No valid device name in EEPROM, using default");
+    Serial.println("No valid device name stored, using default");
   }
 }
 
 /**
- * Save transmitter configuration (ID and power mode) to EEPROM
+ * Stage transmitter configuration (ID and power mode, written by commitConfig)
  */
 void saveTransmitterConfig() {
-  EEPROM.put(EEPROM_TRANSMITTER_ID_ADDR, transmitterID);
-  EEPROM.put(EEPROM_POWER_MODE_ADDR, powerSaveMode);
-  bool success = EEPROM.commit();
-  delay(50); // Give flash time to complete write
-
-  Serial.printf("Transmitter ID %d saved to EEPROM (Power save: %s) - %s\n",
-                transmitterID, powerSaveMode ? "ON" : "OFF", success ? "OK" : "FAILED");
+  stageConfig(&storedConfig.transmitterID, &transmitterID, sizeof(transmitterID));
+  stageConfig(&storedConfig.powerSaveMode, &powerSaveMode, sizeof(powerSaveMode));
 }
 
 /**
- * Load transmitter configuration (ID and power mode) from EEPROM
+ * Load transmitter configuration (ID and power mode) from the config record
  */
 void loadTransmitterConfig() {
-  uint16_t savedID;
-  bool savedPowerMode;
-
-  EEPROM.get(EEPROM_TRANSMITTER_ID_ADDR, savedID);
-  EEPROM.get(EEPROM_POWER_MODE_ADDR, savedPowerMode);
+  uint16_t savedID = storedConfig.transmitterID;
+  uint8_t savedPowerMode;
+  memcpy(&savedPowerMode, &storedConfig.powerSaveMode, 1);  // Raw byte, may be 0xFF when erased
 
   // Validate transmitter ID (0-65535, but 0xFFFF likely means uninitialized)
   if (savedID != 0xFFFF) {
     transmitterID = savedID;
   } else {
-    Serial.println("No transmitter ID in EEPROM, using default (1)");
+    Serial.println("No transmitter ID stored, using default (1)");
     transmitterID = 1;
   }
 
@@ -924,7 +2308,7 @@ void loadTransmitterConfig() {
   if (savedPowerMode == 0 || savedPowerMode == 1) {
     powerSaveMode = savedPowerMode;
   } else {
-    Serial.println("Invalid power mode in EEPROM, using default (OFF)");
+    Serial.println("Invalid power mode stored, using default (OFF)");
     powerSaveMode = false;
   }
 
@@ -932,9 +2316,144 @@ void loadTransmitterConfig() {
                 transmitterID, powerSaveMode ? "ON" : "OFF");
 }
 
+/**
+ * Stage per-sensor resolution profile (written by commitConfig)
+ */
+void saveResolutionProfile() {
+  stageConfig(&storedConfig.resolution, &resolutionProfile, sizeof(resolutionProfile));
+}
+
+/**
+ * Load per-sensor resolution profile from the config record
+ * Out-of-range entries (e.g. erased 0xFF) fall back to DEFAULT_RESOLUTION
+ */
+void loadResolutionProfile() {
+  ResolutionProfile saved;
+  memcpy(&saved, &storedConfig.resolution, sizeof(saved));
+
+  for (int i = 0; i < MAX_SENSOR_COUNT; i++) {
+    bool valid = saved.bits[i] >= TEMP_PRECISION_MIN && saved.bits[i] <= TEMP_PRECISION;
+    resolutionProfile.bits[i] = valid ? saved.bits[i] : DEFAULT_RESOLUTION;
+  }
+
+  // Validate it's a boolean value (erased flash reads 0xFF), default ON
+  uint8_t autoEscalate;
+  memcpy(&autoEscalate, &saved.autoEscalate, 1);
+  if (autoEscalate == 0 || autoEscalate == 1) {
+    resolutionProfile.autoEscalate = saved.autoEscalate;
+  } else {
+    resolutionProfile.autoEscalate = true;
+  }
+
+  Serial.printf("Loaded resolution profile: ambient %d bit, auto-escalate %s\n",
+                resolutionProfile.bits[0], resolutionProfile.autoEscalate ? "ON" : "OFF");
+}
+
+/**
+ * Read the config record from NVS into storedConfig
+ * A missing or corrupt record falls back to the legacy EEPROM layout, and
+ * failing that to an erased record (every loader then uses its default)
+ */
+void loadConfigStore() {
+  Preferences store;
+  bool valid = false;
+
+  if (store.begin(CONFIG_NAMESPACE, true)) {
+    valid = store.getBytes(CONFIG_KEY, &storedConfig, sizeof(storedConfig)) == sizeof(storedConfig) &&
+            storedConfig.version == CONFIG_VERSION &&
+            crc16((const uint8_t*)&storedConfig, offsetof(ConfigRecord, crc)) == storedConfig.crc;
+    store.end();
+  }
+
+  if (valid) {
+    Serial.println("Config record loaded from NVS");
+    configDirty = false;
+    return;
+  }
+
+  if (migrateLegacyConfig()) {
+    Serial.println("Migrated config from legacy EEPROM layout");
+  } else {
+    Serial.println("No stored config - using defaults");
+    memset(&storedConfig, 0xFF, sizeof(storedConfig));
+    storedConfig.sensorsSaved = false;
+  }
+  storedConfig.version = CONFIG_VERSION;
+  configDirty = true;
+  commitConfig();
+}
+
+/**
+ * Copy the pre-NVS EEPROM layout into storedConfig, as the fields were
+ * Values are validated by the loaders exactly as they were when read from EEPROM
+ * Returns false if the EEPROM was never written by this firmware
+ */
+bool migrateLegacyConfig() {
+  if (!EEPROM.begin(EEPROM_SIZE)) return false;
+
+  uint16_t magic;
+  EEPROM.get(EEPROM_MAGIC_ADDR, magic);
+  uint16_t savedID;
+  EEPROM.get(EEPROM_TRANSMITTER_ID_ADDR, savedID);
+
+  // Name, ID and power mode were saved independently of the sensor setup
+  bool anySaved = magic == EEPROM_MAGIC || savedID != 0xFFFF;
+  if (anySaved) {
+    memset(&storedConfig, 0xFF, sizeof(storedConfig));
+    storedConfig.sensorsSaved = magic == EEPROM_MAGIC;
+    for (int i = 0; i < (int)sizeof(storedConfig.sensors); i++) {
+      storedConfig.sensors[i / 8][i % 8] = EEPROM.read(EEPROM_SENSOR_ADDR + i);
+    }
+    storedConfig.sensorCount = EEPROM.read(EEPROM_SENSOR_COUNT_ADDR);
+    for (int i = 0; i < MAX_DEVICE_NAME_LENGTH; i++) {
+      storedConfig.name[i] = EEPROM.read(EEPROM_NAME_ADDR + i);
+    }
+    storedConfig.transmitterID = savedID;
+    uint8_t* raw = (uint8_t*)&storedConfig.powerSaveMode;
+    *raw = EEPROM.read(EEPROM_POWER_MODE_ADDR);
+    raw = (uint8_t*)&storedConfig.resolution;
+    for (int i = 0; i < (int)sizeof(ResolutionProfile); i++) {
+      raw[i] = EEPROM.read(EEPROM_RESOLUTION_ADDR + i);
+    }
+  }
+
+  EEPROM.end();
+  return anySaved;
+}
+
+/**
+ * Copy `value` into a storedConfig field, marking the record dirty only if it changed
+ */
+void stageConfig(void* field, const void* value, size_t len) {
+  if (memcmp(field, value, len) != 0) {
+    memcpy(field, value, len);
+    configDirty = true;
+  }
+}
+
+/**
+ * Write storedConfig to NVS if anything was staged since the last write
+ * Returns true if NVS holds the current config
+ */
+bool commitConfig() {
+  if (!configDirty) return true;
+
+  storedConfig.version = CONFIG_VERSION;
+  storedConfig.crc = crc16((const uint8_t*)&storedConfig, offsetof(ConfigRecord, crc));
+
+  Preferences store;
+  bool success = store.begin(CONFIG_NAMESPACE, false) &&
+                 store.putBytes(CONFIG_KEY, &storedConfig, sizeof(storedConfig)) == sizeof(storedConfig);
+  store.end();
+
+  if (success) configDirty = false;
+  Serial.printf("Config record saved to NVS: %s\n", success ? "OK" : "FAILED");
+  return success;
+}
+
 /**
  * Enter deep sleep for power efficiency
- * ESP32 will wake up after DEEP_SLEEP_DURATION_US microseconds
+ * ESP32 wakes up when the adaptive schedule wants the next sample
  */
 void enterDeepSleep() {
   // Turn off LEDs
@@ -945,8 +2464,27 @@ void enterDeepSleep() {
   WiFi.disconnect(true);
   WiFi.mode(WIFI_OFF);
 
-  // Configure wake-up timer
-  esp_sleep_enable_timer_wakeup(DEEP_SLEEP_DURATION_US);
+  // Radio sleep keeps its registers, so the next wake skips the reset
+  LoRa.sleep();
+
+  saveWakeCache();
+
+  // Configure wake-up timer - the time spent awake this cycle already counts
+  // towards the interval (millis() restarts at every wake)
+  unsigned long awakeMs = millis();
+
+  awakeStats.cycles++;
+  awakeStats.lastMs = awakeMs;
+  awakeStats.totalMs += awakeMs;
+  if (awakeMs > awakeStats.maxMs) awakeStats.maxMs = awakeMs;
+  logToSerial("Awake %lu ms (avg %lu, max %lu over %lu cycles)", awakeMs,
+              (unsigned long)(awakeStats.totalMs / awakeStats.cycles), awakeStats.maxMs,
+              awakeStats.cycles);
+
+  unsigned long sleepMs = sampleSchedule.intervalMs > awakeMs + SAMPLE_INTERVAL_MIN_MS / 2
+                          ? sampleSchedule.intervalMs - awakeMs
+                          : SAMPLE_INTERVAL_MIN_MS / 2;
+  esp_sleep_enable_timer_wakeup((uint64_t)sleepMs * 1000ULL);
 
   Serial.println("Going to sleep now...");
   Serial.flush();
@@ -956,38 +2494,85 @@ void enterDeepSleep() {
 }
 
 /**
- * Log message to serial buffer (circular buffer)
+ * Keep the resolved configuration in RTC memory for the next wake
+ * Only a configured power-save unit wakes straight into a reading
  */
-void logToSerial(const String& message) {
-  Serial.println(message);
+void saveWakeCache() {
+  wakeCache.valid = sensorsConfigured && powerSaveMode;
+  wakeCache.sensorConfig = sensorConfig;
+  wakeCache.sensorCount = activeSensorCount;
+  wakeCache.transmitterID = transmitterID;
+  wakeCache.resolution = resolutionProfile;
+  memcpy(wakeCache.name, deviceName, sizeof(wakeCache.name));
+}
 
-  serialBuffer[serialBufferIndex].timestamp = millis();
-  serialBuffer[serialBufferIndex].message = message;
+/**
+ * Restore the configuration saveWakeCache() left before deep sleep
+ */
+void restoreWakeCache() {
+  sensorConfig = wakeCache.sensorConfig;
+  activeSensorCount = wakeCache.sensorCount;
+  transmitterID = wakeCache.transmitterID;
+  resolutionProfile = wakeCache.resolution;
+  memcpy(deviceName, wakeCache.name, sizeof(deviceName));
+  sensorsConfigured = true;
+  powerSaveMode = true;
+}
 
-  serialBufferIndex = (serialBufferIndex + 1) % SERIAL_BUFFER_SIZE;
-  if (serialBufferCount < SERIAL_BUFFER_SIZE) {
-    serialBufferCount++;
-  }
+/**
+ * Log a printf-style message to serial and the serial buffer (circular buffer)
+ * Formatted straight into the next record; overlong messages are truncated
+ */
+void logToSerial(const char* format, ...) {
+  if (logMutex) xSemaphoreTake(logMutex, portMAX_DELAY);
+  SerialLogEntry* entry = serialLog.next();
+
+  va_list args;
+  va_start(args, format);
+  vsnprintf(entry->message, sizeof(entry->message), format, args);
+  va_end(args);
+  entry->timestamp = millis();
+
+  Serial.println(entry->message);
+
+  serialLog.commit();
+  if (logMutex) xSemaphoreGive(logMutex);
 }
 
 /**
- * Get serial logs as JSON array
+ * Copy log entry number `written` (0 = first ever logged) out of the ring
+ * Returns false if it has not been written yet or was already overwritten
+ * Web handlers copy one entry at a time so a slow client never holds the lock
  */
-String getSerialLogs() {
-  StaticJsonDocument<8192> doc;
-  JsonArray logs = doc.createNestedArray("logs");
+bool copyLogEntry(unsigned long written, SerialLogEntry* out) {
+  xSemaphoreTake(logMutex, portMAX_DELAY);
+  bool available = serialLog.copy(written, out);
+  xSemaphoreGive(logMutex);
+  return available;
+}
 
-  int start = (serialBufferIndex - serialBufferCount + SERIAL_BUFFER_SIZE) % SERIAL_BUFFER_SIZE;
-  for (int i = 0; i < serialBufferCount; i++) {
-    int idx = (start + i) % SERIAL_BUFFER_SIZE;
-    JsonObject log = logs.createNestedObject();
-    log["timestamp"] = serialBuffer[idx].timestamp;
-    log["message"] = serialBuffer[idx].message;
+/**
+ * Record heap fragmentation for /api/serial
+ */
+void sampleHeap() {
+  uint32_t freeHeap = ESP.getFreeHeap();
+  if (freeHeap == 0) return;
+
+  heapStats.fragmentationPct = 100 - (uint8_t)((uint64_t)ESP.getMaxAllocHeap() * 100 / freeHeap);
+  if (heapStats.fragmentationPct > heapStats.peakFragmentationPct) {
+    heapStats.peakFragmentationPct = heapStats.fragmentationPct;
+  }
+  if (heapStats.fragmentationPct > HEAP_FRAGMENTED_PCT) {
+    heapStats.fragmentedCycles++;
   }
+}
 
-  String output;
-  serializeJson(doc, output);
-  return output;
+/**
+ * Record `stage` as having run from `startedUs` (esp_timer_get_time()) until now
+ * loop() only - the web task records into webPerf
+ */
+void perfRecord(uint8_t stage, int64_t startedUs) {
+  perfStages[stage].record((uint32_t)(esp_timer_get_time() - startedUs));
 }
 
 /**
@@ -1011,210 +2596,45 @@ void setupWiFi() {
  * Handle root page request
  */
 void handleRoot() {
-  String html = R"rawliteral(
-<!doctype html><html><head>
-<meta charset='utf-8'>
-<meta name='viewport' content='width=device-width,initial-scale=1'/>
-<title>AxleWatch TX Config</title>
-<style>
-body{font-family:sans-serif;margin:16px;background:#0b1220;color:#e8eefc}
-h1{font-size:20px;margin:0 0 16px}
-.muted{opacity:.7;font-size:14px}
-.card{background:#141b2d;border:1px solid #334;border-radius:10px;padding:20px;margin:16px 0}
-.card h2{color:#4cc9f0;margin:0 0 16px;border-bottom:2px solid #4cc9f0;padding-bottom:8px;font-size:18px}
-fieldset{border:1px solid #334;padding:12px;margin:12px 0;border-radius:8px}
-legend{color:#4cc9f0;font-weight:600;padding:0 8px}
-label{display:block;margin:12px 0 4px;font-weight:500}
-input,select{width:100%;padding:10px;border-radius:6px;border:1px solid #334;background:#0b1220;color:#e8eefc;font-size:14px;box-sizing:border-box}
-input:focus,select:focus{outline:none;border-color:#4cc9f0}
-button{padding:12px 20px;border:0;border-radius:8px;background:#4cc9f0;color:#0b1220;font-weight:700;margin-top:12px;width:100%;cursor:pointer;font-size:15px}
-button:hover{background:#3ab8df}
-.grid{display:grid;grid-template-columns:repeat(auto-fit,minmax(140px,1fr));gap:12px;margin:16px 0}
-.sensor-box{background:#1a2332;border:2px solid #445;border-radius:8px;padding:16px;text-align:center}
-.sensor-box h3{font-size:14px;margin:0 0 8px;opacity:.9;color:#4cc9f0}
-.sensor-box .temp{font-size:32px;font-weight:bold;color:#7bd88f}
-.status-row{display:flex;justify-content:space-between;padding:8px 0;border-bottom:1px solid #334}
-.status-row:last-child{border-bottom:none}
-.status-label{color:#888;font-size:14px}
-.status-value{color:#4cc9f0;font-weight:600;font-size:14px}
-#serialLog{background:#000;color:#0f0;padding:12px;border-radius:8px;height:300px;overflow-y:auto;font-family:'Courier New',monospace;font-size:12px;line-height:1.4;border:1px solid #334}
-.log-entry{margin-bottom:4px}
-.timestamp{color:#666;margin-right:8px}
-.success-msg{background:#1a3d2a;border:1px solid #7bd88f;color:#7bd88f;padding:12px;border-radius:8px;margin-top:12px;display:none}
-a{color:#4cc9f0;text-decoration:none}
-a:hover{text-decoration:underline}
-</style>
-</head><body>
-<h1>AxleWatch Transmitter - Configuration</h1>
-<p class='muted'>AP: )rawliteral" + WiFi.softAPIP().toString() + R"rawliteral( | SSID: AxleWatch-TX</p>
-
-<div class='card'>
-<h2>Device Configuration</h2>
-<fieldset><legend>Device Settings</legend>
-<label>Device Name</label>
-<input type='text' id='deviceName' maxlength='31'>
-<label>Transmitter ID (0-65535)</label>
-<input type='number' id='transmitterID' min='0' max='65535' value='1'>
-<label style='display:flex;align-items:center;cursor:pointer;margin-top:16px'>
-<input type='checkbox' id='powerSaveMode' style='width:auto;margin-right:8px'>
-Enable Power Save Mode (Deep Sleep)
-</label>
-<p style='font-size:12px;color:#888;margin:8px 0 0'>Power save mode disables WiFi and uses deep sleep between transmissions for maximum battery life. WiFi will only work during initial setup.</p>
-</fieldset>
-<button onclick='saveConfig()'>Save Configuration</button>
-<div class='success-msg' id='configSuccess'>Configuration saved successfully!</div>
-</div>
-
-<div class='card'>
-<h2>Sensor Readings</h2>
-<div class='sensor-box' style='margin-bottom:16px;background:#1a3d2a;border-color:#7bd88f'>
-<h3>Ambient</h3>
-<div class='temp' id='temp0'>--</div>
-</div>
-<div class='grid' id='sensorGrid'>
-<!-- Additional sensors will be dynamically added here -->
-</div>
-<div class='status-row'>
-<span class='status-label'>Active Sensors:</span>
-<span class='status-value' id='sensorCount'>0</span>
-</div>
-<div class='status-row'>
-<span class='status-label'>Last Update:</span>
-<span class='status-value' id='lastUpdate'>Never</span>
-</div>
-</div>
-
-<div class='card'>
-<h2>LoRa Status</h2>
-<div class='status-row'>
-<span class='status-label'>Frequency:</span>
-<span class='status-value'>433 MHz (SF7, BW125)</span>
-</div>
-<div class='status-row'>
-<span class='status-label'>TX Power:</span>
-<span class='status-value'>20 dBm</span>
-</div>
-<div class='status-row'>
-<span class='status-label'>Total Packets:</span>
-<span class='status-value' id='totalPackets'>0</span>
-</div>
-<div class='status-row'>
-<span class='status-label'>Last Transmission:</span>
-<span class='status-value' id='lastTx'>Never</span>
-</div>
-</div>
-
-<div class='card'>
-<h2>Serial Monitor</h2>
-<div id='serialLog'></div>
-</div>
-
-<script>
-// Load configuration
-fetch('/api/config')
-  .then(r=>r.json())
-  .then(data=>{
-    document.getElementById('deviceName').value=data.name;
-    document.getElementById('transmitterID').value=data.transmitterID;
-    document.getElementById('powerSaveMode').checked=data.powerSaveMode;
-  });
-
-// Save configuration
-function saveConfig(){
-  const name=document.getElementById('deviceName').value;
-  const transmitterID=parseInt(document.getElementById('transmitterID').value);
-  const powerSaveMode=document.getElementById('powerSaveMode').checked;
-  fetch('/api/config',{
-    method:'POST',
-    headers:{'Content-Type':'application/json'},
-    body:JSON.stringify({name:name,transmitterID:transmitterID,powerSaveMode:powerSaveMode})
-  })
-  .then(r=>r.json())
-  .then(data=>{
-    const msg=document.getElementById('configSuccess');
-    msg.style.display='block';
-    setTimeout(()=>{msg.style.display='none';},3000);
-  });
-}
-
-// Update data
-function updateData(){
-  fetch('/api/data')
-    .then(r=>r.json())
-    .then(data=>{
-      if(data.valid){
-        document.getElementById('sensorCount').textContent=data.count;
-        document.getElementById('temp0').textContent=data.temps[0].toFixed(1)+'C';
-
-        const grid=document.getElementById('sensorGrid');
-        grid.innerHTML='';
-        for(let i=1;i<data.count;i++){
-          const box=document.createElement('div');
-          box.className='sensor-box';
-          box.innerHTML='<h3>Position '+i+'</h3><div class="temp">'+data.temps[i].toFixed(1)+'C</div>';
-          grid.appendChild(box);
-        }
-
-        const date=new Date(data.timestamp*1000);
-        document.getElementById('lastUpdate').textContent=date.toLocaleTimeString();
-      }
-    });
-}
-
-// Update LoRa
-function updateLoRa(){
-  fetch('/api/lora')
-    .then(r=>r.json())
-    .then(data=>{
-      document.getElementById('totalPackets').textContent=data.totalPackets;
-      if(data.lastPacketTime>0){
-        const elapsed=Math.floor((Date.now()-data.lastPacketTime)/1000);
-        document.getElementById('lastTx').textContent=elapsed+'s ago';
-      }
-    });
-}
-
-// Update serial
-function updateSerial(){
-  fetch('/api/serial')
-    .then(r=>r.json())
-    .then(data=>{
-      const logDiv=document.getElementById('serialLog');
-      logDiv.innerHTML='';
-      data.logs.forEach(entry=>{
-        const div=document.createElement('div');
-        div.className='log-entry';
-        const ts=Math.floor(entry.timestamp/1000);
-        div.innerHTML='<span class="timestamp">['+ts+'s]</span>'+entry.message;
-        logDiv.appendChild(div);
-      });
-      logDiv.scrollTop=logDiv.scrollHeight;
-    });
+  sendStaticPage(TX_INDEX_HTML_GZ, TX_INDEX_HTML_GZ_LEN, TX_INDEX_HTML_ETAG);
 }
 
-// Refresh all
-function refreshAll(){
-  updateData();
-  updateLoRa();
-  updateSerial();
-}
+/**
+ * Send a gzipped page from flash, or 304 if the browser's copy is current
+ * The page URL stays the same across firmware updates, so browsers are told
+ * to revalidate every time - that round trip carries only headers
+ */
+void sendStaticPage(const uint8_t* gz, size_t len, const char* etag) {
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Cache-Control", "no-cache");
+  if (server.header("If-None-Match") == etag) {
+    server.send(304);
+    return;
+  }
 
-setInterval(refreshAll,2000);
-refreshAll();
-</script>
-</body></html>
-)rawliteral";
-  server.send(200, "text/html", html);
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/html", (PGM_P)gz, len);
 }
 
 /**
  * Handle GET /api/config
  */
 void handleApiConfigGet() {
-  StaticJsonDocument<128> doc;
-  doc["name"] = deviceName;
-  doc["transmitterID"] = transmitterID;
-  doc["powerSaveMode"] = powerSaveMode;
+  WebSnapshot snap = takeSnapshot();
+  StaticJsonDocument<512> doc;
+  doc["name"] = snap.name;
+  doc["transmitterID"] = snap.transmitterID;
+  doc["powerSaveMode"] = snap.powerSaveMode;
+  doc["apIP"] = WiFi.softAPIP().toString();
+  doc["autoResolution"] = snap.resolution.autoEscalate;
+
+  // Configured resolution per slot, and what each sensor is running at right now
+  JsonArray resolutions = doc.createNestedArray("resolutions");
+  JsonArray active = doc.createNestedArray("activeResolutions");
+  for (int i = 0; i < snap.sensorCount; i++) {
+    resolutions.add(snap.resolution.bits[i]);
+    active.add(snap.activeResolution[i]);
+  }
   String response;
   serializeJson(doc, response);
   server.send(200, "application/json", response);
@@ -1222,39 +2642,85 @@ void handleApiConfigGet() {
 
 /**
  * Handle POST /api/config
+ * Validated settings are queued for loop() to apply (applyPendingConfig);
+ * the response reports the configuration as it will be once they land
  */
 void handleApiConfigPost() {
   if (server.hasArg("plain")) {
     String body = server.arg("plain");
-    StaticJsonDocument<128> doc;
+    StaticJsonDocument<384> doc;
     DeserializationError error = deserializeJson(doc, body);
 
     if (!error) {
+      WebSnapshot snap = takeSnapshot();
+      ConfigRequest req = {};
+      req.pending = true;
+
       if (doc.containsKey("name")) {
         const char* newName = doc["name"];
-        strncpy(deviceName, newName, MAX_DEVICE_NAME_LENGTH - 1);
-        deviceName[MAX_DEVICE_NAME_LENGTH - 1] = 0;
-        saveDeviceName();
+        strncpy(req.name, newName, MAX_DEVICE_NAME_LENGTH - 1);
+        req.hasName = true;
       }
 
       if (doc.containsKey("transmitterID")) {
-        uint16_t newID = doc["transmitterID"];
-        transmitterID = newID;
+        req.transmitterID = doc["transmitterID"];
+        req.hasTransmitterID = true;
       }
 
       if (doc.containsKey("powerSaveMode")) {
-        bool newPowerMode = doc["powerSaveMode"];
-        powerSaveMode = newPowerMode;
+        req.powerSaveMode = doc["powerSaveMode"];
+        req.hasPowerSaveMode = true;
       }
 
-      // Save transmitter config
-      saveTransmitterConfig();
+      if (doc.containsKey("resolutions")) {
+        JsonArray resolutions = doc["resolutions"];
+        int i = 0;
+        for (JsonVariant v : resolutions) {
+          if (i >= MAX_SENSOR_COUNT) break;
+          uint8_t bits = v.as<uint8_t>();
+          if (bits >= TEMP_PRECISION_MIN && bits <= TEMP_PRECISION) {
+            req.resolutions[i] = bits;
+          }
+          i++;
+        }
+      }
+
+      if (doc.containsKey("autoResolution")) {
+        req.autoResolution = doc["autoResolution"];
+        req.hasAutoResolution = true;
+      }
 
-      StaticJsonDocument<128> response;
+      // Merge with anything still queued, latest value wins
+      xSemaphoreTake(stateMutex, portMAX_DELAY);
+      if (!pendingConfig.pending) pendingConfig = {};
+      pendingConfig.pending = true;
+      if (req.hasName) {
+        memcpy(pendingConfig.name, req.name, sizeof(req.name));
+        pendingConfig.hasName = true;
+      }
+      if (req.hasTransmitterID) {
+        pendingConfig.transmitterID = req.transmitterID;
+        pendingConfig.hasTransmitterID = true;
+      }
+      if (req.hasPowerSaveMode) {
+        pendingConfig.powerSaveMode = req.powerSaveMode;
+        pendingConfig.hasPowerSaveMode = true;
+      }
+      for (int i = 0; i < MAX_SENSOR_COUNT; i++) {
+        if (req.resolutions[i] != 0) pendingConfig.resolutions[i] = req.resolutions[i];
+      }
+      if (req.hasAutoResolution) {
+        pendingConfig.autoResolution = req.autoResolution;
+        pendingConfig.hasAutoResolution = true;
+      }
+      xSemaphoreGive(stateMutex);
+
+      StaticJsonDocument<256> response;
       response["success"] = true;
-      response["name"] = deviceName;
-      response["transmitterID"] = transmitterID;
-      response["powerSaveMode"] = powerSaveMode;
+      response["name"] = req.hasName ? req.name : snap.name;
+      response["transmitterID"] = req.hasTransmitterID ? req.transmitterID : snap.transmitterID;
+      response["powerSaveMode"] = req.hasPowerSaveMode ? req.powerSaveMode : snap.powerSaveMode;
+      response["autoResolution"] = req.hasAutoResolution ? req.autoResolution : snap.resolution.autoEscalate;
       String output;
       serializeJson(response, output);
       server.send(200, "application/json", output);
@@ -1270,43 +2736,463 @@ void handleApiConfigPost() {
  * Handle GET /api/data
  */
 void handleApiData() {
-  StaticJsonDocument<512> doc;
-  doc["valid"] = latestData.valid;
-  doc["count"] = activeSensorCount;
-  doc["timestamp"] = latestData.timestamp;
+  WebSnapshot snap = takeSnapshot();
+  StaticJsonDocument<2048> doc;
+  fillDataJson(doc, snap);
+
+  // Bus health per slot - only here, the pushed `data` event stays small
+  JsonArray health = doc.createNestedArray("sensorHealth");
+  for (int i = 0; i < snap.sensorCount; i++) {
+    const SensorHealth& h = snap.health[i];
+    JsonObject entry = health.createNestedObject();
+    entry["reads"] = h.reads;
+    entry["crcErrors"] = h.crcErrors;
+    entry["disconnects"] = h.disconnects;
+    entry["powerOnResets"] = h.powerOnResets;
+    entry["retries"] = h.retries;
+    entry["invalid"] = h.invalid;
+    entry["readUs"] = h.lastReadUs;
+    entry["maxReadUs"] = h.maxReadUs;
+  }
 
+  String response;
+  serializeJson(doc, response);
+  server.send(200, "application/json", response);
+}
+
+/**
+ * Contents of /api/data, also pushed as the `data` event
+ */
+void fillDataJson(JsonDocument& doc, const WebSnapshot& snap) {
+  doc["valid"] = snap.data.valid;
+  doc["count"] = snap.sensorCount;
+  doc["timestamp"] = snap.data.timestamp;
+  doc["utcSynced"] = snap.data.utcSynced;
+  doc["sampleIntervalMs"] = snap.sampleIntervalMs;
+
+  // null for a sensor that could not be read this cycle
   JsonArray temps = doc.createNestedArray("temps");
-  for (int i = 0; i < activeSensorCount; i++) {
-    temps.add(latestData.temps[i]);
+  for (int i = 0; i < snap.sensorCount; i++) {
+    if (centiValid(snap.data.centi[i])) {
+      temps.add(snap.data.temps[i]);
+    } else {
+      temps.add(nullptr);
+    }
   }
+}
+
+/**
+ * Handle GET /api/commission - setup mode state and every sensor on the bus
+ */
+void handleApiCommissionGet() {
+  WebSnapshot snap = takeSnapshot();
+  StaticJsonDocument<2560> doc;
+  fillCommissionJson(doc, snap);
 
   String response;
   serializeJson(doc, response);
   server.send(200, "application/json", response);
 }
 
+/**
+ * Contents of /api/commission, also pushed as the `commission` event
+ */
+void fillCommissionJson(JsonDocument& doc, const WebSnapshot& snap) {
+  const CommissionView& view = snap.commission;
+  doc["active"] = view.active;
+  doc["position"] = view.position;
+  doc["maxPositions"] = MAX_SENSOR_COUNT;
+  doc["scans"] = view.scans;
+  doc["elapsedMs"] = view.elapsedMs;
+  doc["message"] = view.message;
+
+  JsonArray devices = doc.createNestedArray("devices");
+  for (int i = 0; i < view.deviceCount; i++) {
+    char address[17];
+    for (int b = 0; b < 8; b++) {
+      snprintf(address + 2 * b, 3, "%02X", view.devices[i].address[b]);
+    }
+    JsonObject dev = devices.createNestedObject();
+    dev["address"] = address;
+    dev["temp"] = view.devices[i].tempC;
+    dev["slope"] = view.devices[i].slopeCPerS;
+    dev["position"] = view.devices[i].position;
+  }
+}
+
+/**
+ * Handle POST /api/commission {"action":"start|assign|undo|save|cancel","device":n}
+ * Queued for loop() (applyPendingCommission), one command at a time
+ */
+void handleApiCommissionPost() {
+  if (!server.hasArg("plain")) {
+    server.send(400, "application/json", "{\"error\":\"No body\"}");
+    return;
+  }
+
+  StaticJsonDocument<128> doc;
+  if (deserializeJson(doc, server.arg("plain"))) {
+    server.send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
+    return;
+  }
+
+  const char* action = doc["action"];
+  if (!action) action = "";
+  CommissionRequest req = {0, 0};
+  if (strcmp(action, "start") == 0) {
+    req.command = COMMISSION_CMD_START;
+  } else if (strcmp(action, "assign") == 0 && doc["device"].is<int>()) {
+    int device = doc["device"];
+    if (device < 0 || device >= COMMISSION_MAX_DEVICES) {
+      server.send(400, "application/json", "{\"error\":\"Invalid device\"}");
+      return;
+    }
+    req.command = COMMISSION_CMD_ASSIGN;
+    req.device = device;
+  } else if (strcmp(action, "undo") == 0) {
+    req.command = COMMISSION_CMD_UNDO;
+  } else if (strcmp(action, "save") == 0) {
+    req.command = COMMISSION_CMD_SAVE;
+  } else if (strcmp(action, "cancel") == 0) {
+    req.command = COMMISSION_CMD_CANCEL;
+  } else {
+    server.send(400, "application/json", "{\"error\":\"Unknown action\"}");
+    return;
+  }
+
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  bool busy = pendingCommission.command != 0;
+  if (!busy) pendingCommission = req;
+  xSemaphoreGive(stateMutex);
+
+  if (busy) {
+    server.send(409, "application/json", "{\"error\":\"Previous command still pending\"}");
+    return;
+  }
+  server.send(200, "application/json", "{\"success\":true}");
+}
+
 /**
  * Handle GET /api/lora
  */
 void handleApiLora() {
-  StaticJsonDocument<256> doc;
-  doc["totalPackets"] = loraStats.totalPackets;
-  doc["lastPacketTime"] = loraStats.lastPacketTime;
+  WebSnapshot snap = takeSnapshot();
+  StaticJsonDocument<768> doc;
+  fillLoraJson(doc, snap);
+
+  String response;
+  serializeJson(doc, response);
+  server.send(200, "application/json", response);
+}
+
+/**
+ * Contents of /api/lora, also pushed as the `lora` event
+ */
+void fillLoraJson(JsonDocument& doc, const WebSnapshot& snap) {
+  const LoRaStats& lora = snap.lora;
+  doc["totalPackets"] = lora.totalPackets;
+  doc["lastPacketTime"] = lora.lastPacketTime;
+  doc["acksExpected"] = lora.acksExpected;
+  doc["acksReceived"] = lora.acksReceived;
+  if (lora.acksExpected > 0) {
+    doc["deliveryRatio"] = (float)lora.acksReceived / lora.acksExpected;
+  }
+  if (lora.acksReceived > 0) {
+    doc["rssi"] = lora.rssi;
+    doc["snr"] = lora.snr;
+    doc["uplinkRssi"] = lora.uplinkRssi;
+    doc["uplinkSnr"] = lora.uplinkSnr;
+    // Headroom above the SNR the spreading factor can still demodulate
+    doc["linkMarginDb"] = lora.uplinkSnr - LORA_SNR_FLOOR_DB;
+  }
+  doc["keyframes"] = lora.keyframes;
+  doc["deltaFrames"] = lora.deltaFrames;
+  doc["suppressedCycles"] = lora.suppressedCycles;
+  doc["backfillFrames"] = lora.backfillFrames;
+  doc["storedReadings"] = snap.storedReadings;
+  doc["undeliveredReadings"] = snap.undeliveredReadings;
   doc["frequency"] = "433 MHz";
-  doc["txPower"] = "20 dBm";
+  doc["txPower"] = String(snap.power.txPowerDbm) + " dBm";
+  doc["adrEnabled"] = ENABLE_ADR;
+  doc["slotSynced"] = snap.slotSynced;
+  doc["slot"] = snap.slot;
+  doc["lbtBackoffs"] = lora.lbtBackoffs;
+  doc["lbtForced"] = lora.lbtForced;
+  doc["adrPowerChanges"] = snap.power.powerChanges;
+  if (snap.power.samples > 0) {
+    doc["adrMarginAvgDb"] = snap.power.marginAvgDb;
+  }
   doc["spreadingFactor"] = "SF7";
   doc["bandwidth"] = "125 kHz";
+}
+
+/**
+ * Handle GET /api/perf - stage timings, radio duty cycle, awake time and heap,
+ * all since boot (sized for field-trial scraping, nothing here is pushed)
+ */
+void handleApiPerf() {
+  WebSnapshot snap = takeSnapshot();
+  StaticJsonDocument<2048> doc;
+
+  int64_t uptimeUs = esp_timer_get_time();
+  doc["uptimeMs"] = (uint32_t)(uptimeUs / 1000);
+
+  JsonObject stages = doc.createNestedObject("stages");
+  for (int i = 0; i < PERF_STAGE_COUNT; i++) {
+    fillPerfStageJson(stages.createNestedObject(perfStageNames[i]), snap.perf[i]);
+  }
+  fillPerfStageJson(stages.createNestedObject("web"), webPerf);
+
+  // Share of the time since boot spent transmitting
+  if (uptimeUs > 0) {
+    doc["radioDutyCycle"] = (float)snap.perf[PERF_AIRTIME].totalUs / uptimeUs;
+  }
+
+  // Power-save cycles (kept across deep sleep)
+  JsonObject awake = doc.createNestedObject("awake");
+  awake["cycles"] = snap.awake.cycles;
+  awake["lastMs"] = snap.awake.lastMs;
+  awake["maxMs"] = snap.awake.maxMs;
+  if (snap.awake.cycles > 0) {
+    awake["avgMs"] = (unsigned long)(snap.awake.totalMs / snap.awake.cycles);
+  }
+
+  JsonObject heap = doc.createNestedObject("heap");
+  heap["free"] = ESP.getFreeHeap();
+  heap["minFree"] = ESP.getMinFreeHeap();
+  heap["largestFreeBlock"] = ESP.getMaxAllocHeap();
+  if (ESP.getPsramSize() > 0) {
+    heap["psramFree"] = ESP.getFreePsram();
+    heap["psramMinFree"] = ESP.getMinFreePsram();
+  }
+
   String response;
   serializeJson(doc, response);
   server.send(200, "application/json", response);
 }
 
 /**
- * Handle GET /api/serial
+ * One /api/perf stage: count, min/avg/p50/p99/max in microseconds
+ */
+void fillPerfStageJson(JsonObject out, const PerfStage& stage) {
+  out["count"] = stage.count;
+  out["minUs"] = stage.minUs;
+  out["avgUs"] = stage.averageUs();
+  out["p50Us"] = stage.percentileUs(0.50f);
+  out["p99Us"] = stage.percentileUs(0.99f);
+  out["maxUs"] = stage.maxUs;
+}
+
+/**
+ * Handle GET /api/events
+ * Opens a server-sent event stream: `data` and `lora` events (same JSON as
+ * /api/data and /api/lora) after every transmit cycle, and a `log` event per
+ * serial log line. The socket is kept past the handler and fed by publishEvents()
+ */
+void handleApiEvents() {
+  int slot = 0;
+  for (int i = 0; i < EVENT_MAX_CLIENTS; i++) {
+    if (!eventClients[i].connected()) {
+      slot = i;
+      break;
+    }
+  }
+  // With every slot in use the first client is replaced
+  eventClients[slot].stop();
+
+  WiFiClient client = server.client();
+  client.print("HTTP/1.1 200 OK\r\n"
+               "Content-Type: text/event-stream\r\n"
+               "Cache-Control: no-cache\r\n"
+               "Connection: keep-alive\r\n\r\n"
+               "retry: 3000\n\n");
+  eventClients[slot] = client;
+  lastEventSent = millis();
+}
+
+/**
+ * Push pending changes to the event clients (called from webServerTask)
+ */
+void publishEvents() {
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  uint8_t events = eventsPending;
+  eventsPending = 0;
+  xSemaphoreGive(stateMutex);
+
+  xSemaphoreTake(logMutex, portMAX_DELAY);
+  unsigned long written = serialLog.written;
+  int buffered = serialLog.count;
+  xSemaphoreGive(logMutex);
+
+  bool anyClient = false;
+  for (int i = 0; i < EVENT_MAX_CLIENTS; i++) {
+    if (eventClients[i].connected()) anyClient = true;
+  }
+  if (!anyClient) {
+    serialLogPublished = written;
+    return;
+  }
+
+  char buf[2 * SERIAL_LOG_MESSAGE_LENGTH + 64];
+
+  if (events & (EVENT_DATA | EVENT_LORA)) {
+    WebSnapshot snap = takeSnapshot();
+    if (events & EVENT_DATA) {
+      StaticJsonDocument<512> doc;
+      fillDataJson(doc, snap);
+      sendEvent("data", buf, serializeJson(doc, buf, sizeof(buf)));
+    }
+    if (events & EVENT_LORA) {
+      StaticJsonDocument<768> doc;
+      fillLoraJson(doc, snap);
+      sendEvent("lora", buf, serializeJson(doc, buf, sizeof(buf)));
+    }
+  }
+
+  if (events & EVENT_COMMISSION) {
+    // Up to COMMISSION_MAX_DEVICES entries - too big for buf; only this task uses it
+    static char commissionBuf[1536];
+    WebSnapshot snap = takeSnapshot();
+    StaticJsonDocument<2560> doc;
+    fillCommissionJson(doc, snap);
+    sendEvent("commission", commissionBuf, serializeJson(doc, commissionBuf, sizeof(commissionBuf)));
+  }
+
+  // Lines that already dropped out of the ring are skipped
+  if (written - serialLogPublished > (unsigned long)buffered) {
+    serialLogPublished = written - buffered;
+  }
+  SerialLogEntry entry;
+  while (serialLogPublished < written) {
+    if (copyLogEntry(serialLogPublished, &entry)) {
+      size_t len = snprintf(buf, sizeof(buf), "{\"seq\":%lu,\"timestamp\":%lu,\"message\":",
+                            serialLogPublished, entry.timestamp);
+      len += appendJsonString(buf + len, sizeof(buf) - len - 1, entry.message);
+      buf[len++] = '}';
+      sendEvent("log", buf, len);
+    }
+    serialLogPublished++;
+  }
+
+  if (millis() - lastEventSent >= EVENT_KEEPALIVE_MS) {
+    for (int i = 0; i < EVENT_MAX_CLIENTS; i++) {
+      if (eventClients[i].connected()) eventClients[i].print(": keepalive\n\n");
+    }
+    lastEventSent = millis();
+  }
+}
+
+/**
+ * Write one event to every connected client; a client that fails the write is dropped
+ */
+void sendEvent(const char* name, const char* data, size_t len) {
+  char head[32];
+  int headLen = snprintf(head, sizeof(head), "event: %s\ndata: ", name);
+
+  for (int i = 0; i < EVENT_MAX_CLIENTS; i++) {
+    WiFiClient& client = eventClients[i];
+    if (!client.connected()) continue;
+
+    if (client.write((const uint8_t*)head, headLen) != (size_t)headLen ||
+        client.write((const uint8_t*)data, len) != len ||
+        client.write((const uint8_t*)"\n\n", 2) != 2) {
+      client.stop();
+    }
+  }
+  lastEventSent = millis();
+}
+
+/**
+ * Handle GET /api/serial[?since=<sequence>]
+ * Streams the log ring straight to the client as chunked JSON, one record
+ * at a time, so RAM per request is one chunk however long the log is.
+ * Entries carry their sequence number (serialLog.written when logged); with
+ * `since`, only entries from that sequence on are sent. Pass back the returned
+ * `cursor` to fetch just the new lines next time - unlike a timestamp it does
+ * not skip lines logged in the same millisecond
  */
 void handleApiSerial() {
-  String logs = getSerialLogs();
-  server.send(200, "application/json", logs);
+  unsigned long since = 0;
+  bool filtered = server.hasArg("since");
+  if (filtered) {
+    since = strtoul(server.arg("since").c_str(), nullptr, 10);
+  }
+
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "");
+
+  char chunk[2 * SERIAL_LOG_MESSAGE_LENGTH + 64];  // Worst case: every character escaped
+  bool first = true;
+
+  server.sendContent("{\"logs\":[");
+  xSemaphoreTake(logMutex, portMAX_DELAY);
+  unsigned long written = serialLog.written;
+  unsigned long oldest = serialLog.oldest();
+  xSemaphoreGive(logMutex);
+  // A cursor beyond `written` is from before a reboot: send the whole ring
+  if (filtered && since > oldest && since <= written) oldest = since;
+
+  // Lines logged while streaming are left for the next cursor
+  SerialLogEntry entry;
+  for (unsigned long n = oldest; n < written; n++) {
+    if (!copyLogEntry(n, &entry)) continue;  // Overwritten mid-stream
+
+    size_t len = snprintf(chunk, sizeof(chunk), "%s{\"seq\":%lu,\"timestamp\":%lu,\"message\":",
+                          first ? "" : ",", n, entry.timestamp);
+    len += appendJsonString(chunk + len, sizeof(chunk) - len - 1, entry.message);
+    chunk[len++] = '}';
+    server.sendContent(chunk, len);
+    first = false;
+  }
+
+  snprintf(chunk, sizeof(chunk),
+           "],\"cursor\":%lu,\"capacity\":%d,\"heap\":{\"size\":%u,\"free\":%u,\"largestFreeBlock\":%u,"
+           "\"peakUsed\":%u,\"fragmentationPct\":%u,\"peakFragmentationPct\":%u,"
+           "\"fragmentedCycles\":%lu}}",
+           written, SERIAL_BUFFER_SIZE, (unsigned)ESP.getHeapSize(), (unsigned)ESP.getFreeHeap(),
+           (unsigned)ESP.getMaxAllocHeap(),
+           (unsigned)(ESP.getHeapSize() - ESP.getMinFreeHeap()),  // High-water mark
+           heapStats.fragmentationPct, heapStats.peakFragmentationPct, heapStats.fragmentedCycles);
+  server.sendContent(chunk);
+  server.sendContent("");  // End of chunked response
+}
+
+/**
+ * Append `text` as a quoted, escaped JSON string; returns the bytes written
+ * Output stops short at `size` rather than overflowing
+ */
+size_t appendJsonString(char* out, size_t size, const char* text) {
+  size_t len = 0;
+  if (len < size) out[len++] = '"';
+
+  for (const char* c = text; *c && len + 7 < size; c++) {
+    switch (*c) {
+      case '"':  out[len++] = '\\'; out[len++] = '"';  break;
+      case '\\': out[len++] = '\\'; out[len++] = '\\'; break;
+      case '\n': out[len++] = '\\'; out[len++] = 'n';  break;
+      case '\r': out[len++] = '\\'; out[len++] = 'r';  break;
+      case '\t': out[len++] = '\\'; out[len++] = 't';  break;
+      default:
+        if ((uint8_t)*c < 0x20) {
+          len += snprintf(out + len, size - len, "\\u%04x", *c);
+        } else {
+          out[len++] = *c;
+        }
+    }
+  }
+
+  if (len < size) out[len++] = '"';
+  return len;
+}
+
+/**
+ * Run a web handler, timing it into webPerf (web task only)
+ */
+template <void (*handler)()>
+void timedHandler() {
+  int64_t started = esp_timer_get_time();
+  handler();
+  webPerf.record((uint32_t)(esp_timer_get_time() - started));
 }
 
 /**
@@ -1316,14 +3202,39 @@ void handleApiSerial() {
 void setupWebServer() {
   Serial.println("Setting up web server...");
 
-  // Route handlers
-  server.on("/", HTTP_GET, handleRoot);
-  server.on("/api/config", HTTP_GET, handleApiConfigGet);
-  server.on("/api/config", HTTP_POST, handleApiConfigPost);
-  server.on("/api/data", HTTP_GET, handleApiData);
-  server.on("/api/lora", HTTP_GET, handleApiLora);
-  server.on("/api/serial", HTTP_GET, handleApiSerial);
+  // Route handlers, each timed into webPerf
+  server.on("/", HTTP_GET, timedHandler<handleRoot>);
+  server.on("/api/config", HTTP_GET, timedHandler<handleApiConfigGet>);
+  server.on("/api/config", HTTP_POST, timedHandler<handleApiConfigPost>);
+  server.on("/api/data", HTTP_GET, timedHandler<handleApiData>);
+  server.on("/api/lora", HTTP_GET, timedHandler<handleApiLora>);
+  server.on("/api/serial", HTTP_GET, timedHandler<handleApiSerial>);
+  server.on("/api/events", HTTP_GET, timedHandler<handleApiEvents>);
+  server.on("/api/commission", HTTP_GET, timedHandler<handleApiCommissionGet>);
+  server.on("/api/commission", HTTP_POST, timedHandler<handleApiCommissionPost>);
+  server.on("/api/perf", HTTP_GET, timedHandler<handleApiPerf>);
+
+  // Needed to answer revalidation of the cached page with 304
+  const char* headerKeys[] = {"If-None-Match"};
+  server.collectHeaders(headerKeys, 1);
 
   server.begin();
   Serial.println("Web server started on http://" + WiFi.softAPIP().toString());
+
+  // Serve HTTP from its own task so a slow client never delays a sample
+  // or a transmit slot, and a long sensor read never stalls the UI
+  xTaskCreatePinnedToCore(webServerTask, "web", WEB_TASK_STACK, nullptr,
+                          WEB_TASK_PRIORITY, &webTaskHandle, WEB_TASK_CORE);
+}
+
+/**
+ * Web server task - handles requests and feeds the event stream
+ * Reads loop() state only through webSnapshot and the locked log ring
+ */
+void webServerTask(void* param) {
+  for (;;) {
+    server.handleClient();
+    publishEvents();
+    vTaskDelay(pdMS_TO_TICKS(2));
+  }
 }
@@ -3,7 +3,7 @@
  * ESP32-S3 Production Firmware
  *
  * Features:
- * - LoRa 433MHz reception from multiple transmitters
+ * - LoRa 433MHz reception from multiple transmitters (binary frames + legacy text)
  * - ILI9341 touchscreen display with live temperature monitoring
  * - GPS integration with TinyGPS++
  * - SD card logging (100+ hours)
@@ -28,10 +28,18 @@
 #include <ESPmDNS.h>
 #include <Preferences.h>
 #include <HTTPClient.h>
+#include <WiFiClientSecure.h>
 #include <ArduinoJson.h>
 #include <SD.h>
 #include <FS.h>
 #include <time.h>
+#include <sys/time.h>
+#include <atomic>
+#include "axlewatch_frame.h"  // Wire format shared with TX
+#include "axlewatch_fleet.h"  // Fleet table, transmitter records and alarm rules
+#include "axlewatch_text.h"   // Legacy text frame parser
+#include "axlewatch_perf.h"   // Stage timing for /api/perf
+#include "rx_web_assets.h"  // Generated from web/ by tools/build_web_assets.py
 
 // ======================== PIN DEFINITIONS ========================
 // ESP32-S3 Pin Assignments - AxleWatch Receiver Hardware
@@ -82,23 +90,97 @@
 #define LORA_SF             7
 #define LORA_BW             125E3
 
-#define NUM_TEMP_SENSORS    9
-#define MAX_TRANSMITTERS    10
+// NUM_TEMP_SENSORS, TEMP_INVALID_* and the alarm rules: axlewatch_fleet.h
+
+// Fleet table capacity, chosen at boot by PSRAM (see setup) - about 140 B per
+// transmitter, so PSRAM boards can track a whole depot yard
+#define FLEET_CAPACITY_INTERNAL 32
+#define FLEET_CAPACITY_PSRAM    256
+
+// Binary frame format, ACK and slot schedule: axlewatch_frame.h (shared with TX)
+// RX accepts v1 and v2 frames; transmit slots are handed out one per active binary
+// transmitter (FleetTable::txSlots), so no two share one
+
+// Radio receive path: DIO0 wakes the LoRa task, which reads, parses and ACKs each
+// frame and queues it for loop(), so uploads and redraws never cost a packet
+#define RX_QUEUE_SIZE       32     // Frames loop() may fall behind by (~370 B each)
+#define RX_TASK_STACK       4096
+#define RX_TASK_PRIORITY    3      // Above loop(), so ACKs always make the TX's window
+#define RX_TASK_CORE        0
+#define RX_DIO0_TIMEOUT_MS  100    // Re-check DIO0 in case a rising edge was missed
 
 #define DEFAULT_WARN_OFFSET     40.0
 #define DEFAULT_CRIT_OFFSET     60.0
 
+// UTC clock (ClockService): GPS time, NTP fallback on STA WiFi
+#define CLOCK_STEP_MS           2000   // Errors above this are stepped, below slewed
+#define CLOCK_GPS_STALE_MS      120000 // Fall back to NTP after this long without GPS time
+#define CLOCK_NTP_INTERVAL_MS   60000  // How often the SNTP-kept system clock is sampled
+#define CLOCK_NTP_SERVER        "pool.ntp.org"
+#define CLOCK_MIN_VALID_UTC     1704067200  // 2024-01-01: anything earlier is unset
+#define CLOCK_MIN_VALID_DATE    20240101
+
 #define AP_MODE_DURATION        60000  // 60 seconds
 #define CLOUD_UPLOAD_INTERVAL   60000  // 60 seconds
+
+// Cloud upload task: loop() snapshots the fleet, the task posts it in batches over
+// one kept-alive TLS connection, so a slow server never stalls the display or radio
+#define UPLOAD_TASK_STACK       12288  // Most of it is the TLS handshake
+#define UPLOAD_TASK_PRIORITY    1      // Below the LoRa task
+#define UPLOAD_TASK_CORE        0
+#define UPLOAD_BATCH_MAX        32     // Trailers per request (~400 B of JSON each)
+#define UPLOAD_TIMEOUT_MS       10000
+#define UPLOAD_MAX_REDIRECTS    3
+
+// Offline spool: readings the cloud did not take (no WiFi, server error) wait here
+// and are replayed oldest first, within the configured byte budget, once it does
+#define SPOOL_RAM_RECORDS_PSRAM     4096   // 48 B each, ~7 h of a 10-trailer fleet
+#define SPOOL_RAM_RECORDS_INTERNAL  128
+#define SPOOL_FLUSH_RECORDS         256    // Moved to SD at a time once the RAM ring fills
+#define SPOOL_FILE                  "/upload_spool.bin"
+#define SPOOL_SD_MAX_BYTES          (16UL * 1024 * 1024)
+#define SPOOL_REPLAY_INTERVAL_MS    5000   // Minimum gap between replay batches
+#define SPOOL_RETRY_MS              30000  // Back-off after a failed upload
+#define DEFAULT_REPLAY_BUDGET       32768  // Replayed JSON bytes per minute, on top of live uploads
 #define DISPLAY_CYCLE_INTERVAL  5000   // 5 seconds
+#define DISPLAY_REFRESH_MS      250    // Check for changed values; only changed cells are redrawn
+#define DISPLAY_CELL_MAX_W      192    // Off-screen cell buffer (192x16 px, 6 KB)
+#define DISPLAY_CELL_MAX_H      16
 #define GPS_UPDATE_INTERVAL     1000   // 1 second
 
+// Server-sent events (/api/events) - pushes live dashboard updates instead of reloading
+#define EVENT_MAX_CLIENTS       2
+#define EVENT_STATUS_INTERVAL   15000  // Status event, doubles as keepalive
+#define EVENT_MAX_PENDING       64     // Trailer updates queued between two pushes
+
 #define AP_SSID                 "AxleWatch-Setup"
 #define AP_PASSWORD             "axlewatch123"
 
 // Set to false to skip SD card initialization (if causing hangs)
 #define ENABLE_SD_CARD          true
 
+// SD logging (SDLogger): write-back buffered, flushed in whole sectors, rotated
+#define SD_LOG_BINARY           false  // true = fixed-width LogRecords, see tools/sd_log_to_csv.py
+#define SD_LOG_DIR              "/logs"
+#define SD_LOG_BUFFER_SIZE      8192   // RAM write-back buffer (16 sectors)
+#define SD_LOG_FLUSH_BYTES      4096   // Write once this much is buffered...
+#define SD_LOG_FLUSH_MS         30000  // ...or the oldest buffered row is this old
+#define SD_LOG_MAX_FILE_BYTES   (8UL * 1024 * 1024)  // Rotate at this size, and daily
+#define SD_SECTOR_SIZE          512
+
+// Stage timing for /api/perf (PerfStage, esp_timer microseconds)
+// Each stage is recorded from one task only
+#define PERF_FRAME_RX           0      // LoRa task: read, parse and ACK one packet
+#define PERF_ACK_AIRTIME        1      // LoRa task: ACK beginPacket() to endPacket()
+#define PERF_FRAME_APPLY        2      // loop(): one queued frame into the fleet, alarms and SD row
+#define PERF_DISPLAY            3      // loop(): one redraw of the changed cells
+#define PERF_SD_WRITE           4      // loop(): one SD flush, write and directory update
+#define PERF_UPLOAD             5      // Upload task: one HTTPS POST, redirects included
+#define PERF_WEB                6      // loop(): one web handler
+#define PERF_LOOP               7      // loop() body
+#define PERF_LOOP_GAP           8      // loop() start to start
+#define PERF_STAGE_COUNT        9
+
 // ======================== GLOBAL OBJECTS ========================
 // SPI Bus Instances (ESP32-S3 has FSPI and HSPI)
 // Per schematic: Display + Touch + SD share FSPI, LoRa uses HSPI
@@ -113,16 +195,67 @@ HardwareSerial gpsSerial(2);
 WebServer webServer(80);
 Preferences prefs;
 
+// Stage timings, reported by /api/perf
+PerfStage perfStages[PERF_STAGE_COUNT] = {};
+const char* const perfStageNames[PERF_STAGE_COUNT] = {
+  "frameRx", "ackAirtime", "frameApply", "display", "sdWrite", "upload", "web", "loop", "loopGap"
+};
+
+// Record `stage` as having run from `startedUs` (esp_timer_get_time()) until now
+inline void perfRecord(uint8_t stage, int64_t startedUs) {
+  perfStages[stage].record((uint32_t)(esp_timer_get_time() - startedUs));
+}
+
 // ======================== DATA STRUCTURES ========================
 
-struct TransmitterData {
-  char txID[16];
-  float temps[NUM_TEMP_SENSORS];
-  float ambientTemp;
-  unsigned long lastReceived;
+// Per-packet metadata that does not belong in the transmitter slot
+struct FrameInfo {
+  uint8_t type;      // FRAME_TYPE_* (legacy text reports as READINGS)
+  uint8_t sequence;
+  uint16_t mask;     // Slots carried by this frame (bit 0 = ambient)
+  uint8_t batchCount; // BATCH frames: stored readings carried, see LoRaManager::batchReading
+  uint16_t txNumber;  // Numeric transmitter ID, addresses the ACK (binary frames only)
+};
+
+// A frame as taken off the radio, parsed on the LoRa task
+struct ReceivedFrame {
+  uint8_t data[256];   // Raw payload, NUL-terminated (legacy text is parsed in place)
+  int len;
   int rssi;
-  bool active;
-  uint8_t alarmLevels[NUM_TEMP_SENSORS]; // 0=OK, 1=WARN, 2=CRIT
+  float snr;
+  bool valid;          // Parsed into tx/info
+  TransmitterData tx;
+  FrameInfo info;
+};
+
+// Single-producer (LoRa task), single-consumer (loop) ring - no locks needed,
+// each index is only ever written by one side. The two tasks run on different
+// cores, so the indices are published with release and read with acquire: a
+// frame's contents are visible before the head that covers it, and a slot is
+// drained before the tail that frees it
+struct ReceiveQueue {
+  ReceivedFrame frames[RX_QUEUE_SIZE];
+  std::atomic<uint32_t> head{0};     // Next slot to fill, written by the LoRa task
+  std::atomic<uint32_t> tail{0};     // Next slot to drain, written by loop()
+  unsigned long overflows = 0;       // Frames dropped (and not ACKed) with the ring full
+  uint32_t highWater = 0;
+
+  ReceivedFrame* reserve() {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    return (h - tail.load(std::memory_order_acquire) < RX_QUEUE_SIZE) ? &frames[h % RX_QUEUE_SIZE] : nullptr;
+  }
+  void commit() {
+    uint32_t h = head.load(std::memory_order_relaxed) + 1;
+    head.store(h, std::memory_order_release);
+    uint32_t depth = h - tail.load(std::memory_order_relaxed);
+    if (depth > highWater) highWater = depth;
+  }
+  ReceivedFrame* peek() {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    return (t != head.load(std::memory_order_acquire)) ? &frames[t % RX_QUEUE_SIZE] : nullptr;
+  }
+  void release() { tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+  uint32_t depth() const { return head.load(std::memory_order_relaxed) - tail.load(std::memory_order_relaxed); }
 };
 
 struct GPSData {
@@ -144,6 +277,7 @@ struct SystemConfig {
   float warnOffset;
   float critOffset;
   bool cloudEnabled;
+  uint32_t replayBudget;  // Backlog replay limit, JSON bytes per minute (0 = no replay)
 };
 
 // ======================== CONFIGURATION MANAGER ========================
@@ -183,6 +317,7 @@ public:
     config.warnOffset = prefs.getFloat("warnOffset", DEFAULT_WARN_OFFSET);
     config.critOffset = prefs.getFloat("critOffset", DEFAULT_CRIT_OFFSET);
     config.cloudEnabled = prefs.getBool("cloudEn", true);
+    config.replayBudget = prefs.getUInt("replayBudget", DEFAULT_REPLAY_BUDGET);
 
     // Default cloud endpoint if not set
     if (strlen(config.cloudEndpoint) == 0) {
@@ -199,12 +334,164 @@ public:
     prefs.putFloat("warnOffset", config.warnOffset);
     prefs.putFloat("critOffset", config.critOffset);
     prefs.putBool("cloudEn", config.cloudEnabled);
+    prefs.putUInt("replayBudget", config.replayBudget);
   }
 
   const char* getDeviceID() { return config.deviceID; }
 };
 
+// ======================== CLOCK SERVICE ========================
+// UTC for everything the RX stamps: SD rows, cloud readings, /api/live and, through
+// the ACK, the transmitters. Runs on the 64-bit uptime timer, disciplined by GPS
+// time, or NTP while on STA WiFi and the GPS has none. Small errors are slewed
+// in so time never runs backwards; errors over CLOCK_STEP_MS are stepped
+class ClockService {
+public:
+  enum Source : uint8_t { SOURCE_NONE, SOURCE_GPS, SOURCE_NTP };
+
+  volatile Source source = SOURCE_NONE;  // What the clock was last disciplined by
+  unsigned long syncCount = 0;
+  unsigned long stepCount = 0;
+  int32_t lastErrorMs = 0;               // Source minus our clock at the last sync
+
+  bool synced() const { return source != SOURCE_NONE; }
+
+  static const char* sourceName(Source s) {
+    return s == SOURCE_GPS ? "gps" : s == SOURCE_NTP ? "ntp" : "none";
+  }
+
+  // UTC in milliseconds, 0 until the first sync. Safe from any task
+  uint64_t nowMs() {
+    if (!synced()) return 0;
+    portENTER_CRITICAL(&lock);
+    uint64_t t = uptimeMs() + offsetMs;
+    if (t < lastReturnedMs) {
+      t = lastReturnedMs;  // Being slewed back: hold until real time catches up
+    } else {
+      lastReturnedMs = t;
+    }
+    portEXIT_CRITICAL(&lock);
+    return t;
+  }
+
+  uint32_t nowSeconds() { return nowMs() / 1000; }
+
+  // UTC of an earlier moment of this boot, given as its millis(); 0 if unsynced
+  uint64_t utcAtMillis(unsigned long ms) {
+    if (!synced()) return 0;
+    return uptimeMs() - (uint32_t)(millis() - ms) + offsetMs;
+  }
+
+  // ISO 8601 UTC with seconds, "" for 0 (unknown)
+  static void formatIso(uint64_t utcMs, char* out, size_t len) {
+    if (utcMs == 0) {
+      out[0] = '\0';
+      return;
+    }
+    time_t seconds = utcMs / 1000;
+    struct tm parts;
+    gmtime_r(&seconds, &parts);
+    strftime(out, len, "%Y-%m-%dT%H:%M:%SZ", &parts);
+  }
+
+  // From loop(): GPS first, then NTP if the GPS has not given time for a while
+  void update(bool wifiConnected) {
+    uint64_t gpsUtc;
+    if (gpsTime(&gpsUtc)) {
+      discipline(gpsUtc, SOURCE_GPS);
+      lastGpsSync = millis();
+      return;
+    }
+    bool gpsFresh = lastGpsSync != 0 && millis() - lastGpsSync < CLOCK_GPS_STALE_MS;
+    if (gpsFresh || !wifiConnected) return;
+
+    if (!ntpStarted) {
+      configTime(0, 0, CLOCK_NTP_SERVER);  // SNTP keeps the system clock synced from here on
+      ntpStarted = true;
+    }
+    if (lastNtpCheck != 0 && millis() - lastNtpCheck < CLOCK_NTP_INTERVAL_MS) return;
+    lastNtpCheck = millis();
+
+    // The system clock is only set by SNTP, so a plausible date means it synced
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    if (tv.tv_sec >= CLOCK_MIN_VALID_UTC) {
+      discipline((uint64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000, SOURCE_NTP);
+    }
+  }
+
+private:
+  portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+  int64_t offsetMs = 0;          // UTC minus uptime
+  uint64_t lastReturnedMs = 0;   // Floor that keeps nowMs() monotonic
+  unsigned long lastGpsSync = 0;
+  unsigned long lastNtpCheck = 0;
+  bool ntpStarted = false;
+
+  static uint64_t uptimeMs() { return esp_timer_get_time() / 1000; }
+
+  // Days since 1970-01-01 of a proleptic Gregorian date (no time zone involved)
+  static int64_t daysFromCivil(int year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    unsigned yoe = (unsigned)(year - era * 400);
+    unsigned doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int64_t)doe - 719468;
+  }
+
+  // UTC of the latest GPS time fix, once per new NMEA time. The age TinyGPS
+  // reports covers the time since the sentence was decoded; without a PPS line
+  // the sentence's own transmit delay (~0.1-0.5 s at 9600 baud) remains
+  bool gpsTime(uint64_t* utcMs) {
+    if (!gps.time.isUpdated() || !gps.time.isValid() || !gps.date.isValid()) return false;
+    if (gps.date.year() * 10000UL + gps.date.month() * 100 + gps.date.day() < CLOCK_MIN_VALID_DATE) {
+      return false;  // Receivers report a default date before their first fix
+    }
+    int64_t days = daysFromCivil(gps.date.year(), gps.date.month(), gps.date.day());
+    uint32_t age = gps.time.age();
+    *utcMs = ((days * 24 + gps.time.hour()) * 60 + gps.time.minute()) * 60000LL +
+             gps.time.second() * 1000LL + gps.time.centisecond() * 10 + age;
+    return age < 1000;
+  }
+
+  void discipline(uint64_t sourceUtcMs, Source from) {
+    int64_t target = (int64_t)sourceUtcMs - (int64_t)uptimeMs();
+    int64_t error = target - offsetMs;
+
+    portENTER_CRITICAL(&lock);
+    bool step = !synced() || error > CLOCK_STEP_MS || error < -CLOCK_STEP_MS;
+    if (step) {
+      offsetMs = target;
+      lastReturnedMs = 0;     // A backwards step is deliberate
+    } else {
+      offsetMs += error / 4;  // Slew a quarter of the error per sync
+    }
+    portEXIT_CRITICAL(&lock);
+
+    if (step) {
+      stepCount++;
+      Serial.printf("Clock stepped from %s (%lld ms)\n", sourceName(from), synced() ? (long long)error : 0LL);
+    }
+    source = from;
+    lastErrorMs = (int32_t)constrain(error, (int64_t)INT32_MIN, (int64_t)INT32_MAX);
+    syncCount++;
+  }
+};
+
+extern ClockService clockService;
+
+// ======================== FLEET TABLE ========================
+// FleetTable (axlewatch_fleet.h) lives in PSRAM where the board has it
+void* fleetAllocate(size_t count, size_t size) {
+  return psramFound() ? ps_calloc(count, size) : calloc(count, size);
+}
+
+extern FleetTable fleet;
+
 // ======================== LORA MANAGER ========================
+TaskHandle_t loraTaskHandle = nullptr;
+
 class LoRaManager {
 public:
   void begin() {
@@ -248,112 +535,250 @@ public:
     Serial.print(", BW");
     Serial.print(LORA_BW / 1000);
     Serial.println(" kHz");
+
+    // From here on only the LoRa task touches the radio
+    xTaskCreatePinnedToCore(receiveTask, "lora", RX_TASK_STACK, this,
+                            RX_TASK_PRIORITY, &loraTaskHandle, RX_TASK_CORE);
+    attachInterrupt(digitalPinToInterrupt(LORA_DIO0), onDio0, RISING);
+    LoRa.receive();  // Continuous RX, DIO0 = RxDone
   }
 
-  bool receivePacket(char* buffer, int maxLen, int* rssi) {
-    int packetSize = LoRa.parsePacket();
-    if (packetSize == 0) return false;
+  // Next frame received, or nullptr; call releaseFrame() when done with it
+  ReceivedFrame* nextFrame() { return queue.peek(); }
+  void releaseFrame() { queue.release(); }
 
-    int idx = 0;
-    while (LoRa.available() && idx < maxLen - 1) {
-      buffer[idx++] = (char)LoRa.read();
-    }
-    buffer[idx] = '\0';
+  ReceiveQueue queue;
 
-    *rssi = LoRa.packetRssi();
-    return true;
+  // DIO0 rises on RxDone (and TxDone after an ACK) - just wake the LoRa task,
+  // SPI is not safe from an interrupt
+  static void IRAM_ATTR onDio0() {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(loraTaskHandle, &woken);
+    if (woken) portYIELD_FROM_ISR();
+  }
+
+  static void receiveTask(void* param) {
+    LoRaManager* manager = (LoRaManager*)param;
+    for (;;) {
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(RX_DIO0_TIMEOUT_MS));
+      // DIO0 stays high until the packet is read, so this also catches a missed edge,
+      // and skips the TxDone edge (cleared by endPacket before we get here)
+      if (digitalRead(LORA_DIO0) == HIGH) {
+        manager->receiveFrame();
+      }
+    }
   }
 
-  bool parsePacket(const char* packet, TransmitterData* tx) {
-    // Expected format: TX<ID>:pos1,pos2,...,pos9,ambient OR TRAILER<ID>:... OR DOLLY<ID>:...
-    // Example: TX001:45.2,46.1,0.0,0.0,44.8,45.5,0.0,0.0,0.0,22.5
-    // Example: TRAILER1:23.5,23.4,23.5,0.0,0.0,0.0,0.0,0.0,0.0,23.3
-    // Example: DOLLY2:23.8,22.6,22.7,0.0,0.0,0.0,0.0,0.0,0.0,22.8
-
-    char buffer[128];
-    strncpy(buffer, packet, sizeof(buffer) - 1);
-    buffer[sizeof(buffer) - 1] = '\0';
-
-    // VALIDATION: Check for invalid characters (detect corruption early)
-    // Valid chars: A-Z, a-z, 0-9, '.', ',', ':', '-' (for negative temps)
-    for (int i = 0; buffer[i] != '\0'; i++) {
-      char c = buffer[i];
-      bool valid = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
-                   (c >= '0' && c <= '9') || c == '.' || c == ',' ||
-                   c == ':' || c == '-';
-      if (!valid) {
-        Serial.printf("Invalid character detected at position %d: 0x%02X ('%c')\n", i, c, c);
-        return false; // Corrupted packet
+  // Read the waiting packet, parse it, ACK it if it is ours to ACK, and queue it
+  // Runs on the LoRa task only
+  void receiveFrame() {
+    int64_t started = esp_timer_get_time();
+    int packetSize = LoRa.parsePacket();  // Also drops the radio to standby
+    if (packetSize > 0) {
+      packetsReceived++;
+
+      ReceivedFrame* frame = queue.reserve();
+      ReceivedFrame* target = frame ? frame : &overflowFrame;
+
+      // Buffer is always NUL-terminated so legacy text packets can be parsed in place
+      int idx = 0;
+      while (LoRa.available() && idx < (int)sizeof(target->data) - 1) {
+        target->data[idx++] = (uint8_t)LoRa.read();
+      }
+      target->data[idx] = '\0';
+      target->len = idx;
+      target->rssi = LoRa.packetRssi();
+      target->snr = LoRa.packetSnr();
+
+      if (!frame) {
+        // Not ACKed, so the TX keeps the readings and backfills them later
+        queue.overflows++;
+        Serial.println("LoRa receive queue full - frame dropped");
+      } else {
+        frame->valid = parsePacket(frame->data, frame->len, &frame->tx, &frame->info);
+        if (!frame->valid) {
+          invalidPackets++;
+        } else if (isBinaryFrame(frame->data, frame->len)) {
+          // Legacy text transmitters never listen for an ACK
+          sendAck(&frame->info, frame->rssi, frame->snr, slotFor(frame->info.txNumber));
+        }
+        queue.commit();
       }
+      perfRecord(PERF_FRAME_RX, started);
     }
 
-    // Accept "TX", "TRAILER", or "DOLLY" prefixes
-    bool validPrefix = (strncmp(buffer, "TX", 2) == 0) ||
-                       (strncmp(buffer, "TRAILER", 7) == 0) ||
-                       (strncmp(buffer, "DOLLY", 5) == 0);
-    if (!validPrefix) return false;
+    LoRa.receive();  // Back to continuous RX (parsePacket/ACK left it in standby)
+  }
 
-    // Extract transmitter ID (everything before the colon)
-    char* colonPos = strchr(buffer, ':');
-    if (!colonPos) return false;
+  // Transmit slot of a transmitter, 0xFF if it holds none: every slot is taken,
+  // or its first frame is ACKed before loop() marks it active
+  uint8_t slotFor(uint16_t txNumber) {
+    int slot = fleet.find(txNumber);
+    return slot >= 0 ? fleet.txSlots[slot] : 0xFF;
+  }
 
-    int idLen = colonPos - buffer;
-    if (idLen >= sizeof(tx->txID)) return false;
+  // Acknowledge an accepted binary frame, reporting how it was heard here and
+  // handing out the transmit slot (0xFF = none) along with our slot-frame phase and UTC
+  // Sent straight away: the TX only listens for ACK_WINDOW_MS after its frame
+  void sendAck(const FrameInfo* info, int rssi, float snr, uint8_t slot) {
+    uint8_t ack[ACK_FRAME_SIZE];
+    ack[0] = FRAME_MAGIC;
+    ack[1] = (FRAME_VERSION << 4) | FRAME_TYPE_ACK;
+    ack[2] = info->txNumber & 0xFF;
+    ack[3] = info->txNumber >> 8;
+    ack[4] = info->sequence;
+    ack[5] = (uint8_t)(int8_t)constrain(rssi, -128, 127);
+    ack[6] = (uint8_t)(int8_t)constrain((int)lroundf(snr * 4), -128, 127);
+    uint16_t phase = millis() % SLOT_FRAME_MS;
+    ack[7] = slot;
+    ack[8] = phase & 0xFF;
+    ack[9] = phase >> 8;
+    uint64_t utcMs = clockService.nowMs();
+    uint32_t utcSeconds = utcMs / 1000;
+    uint16_t utcMillis = utcMs % 1000;
+    for (int i = 0; i < 4; i++) ack[10 + i] = utcSeconds >> (8 * i);
+    ack[14] = utcMillis & 0xFF;
+    ack[15] = utcMillis >> 8;
+    frameFinish(ack, ACK_FRAME_SIZE - FRAME_CRC_SIZE);
+
+    int64_t started = esp_timer_get_time();
+    LoRa.beginPacket();
+    LoRa.write(ack, ACK_FRAME_SIZE);
+    LoRa.endPacket();
+    perfRecord(PERF_ACK_AIRTIME, started);
+  }
 
-    strncpy(tx->txID, buffer, idLen);
-    tx->txID[idLen] = '\0';
+  // Channel statistics - corrupted frames are mostly collisions between transmitters
+  // (counted on the LoRa task, read anywhere)
+  unsigned long packetsReceived = 0;
+  unsigned long crcErrors = 0;
+  unsigned long invalidPackets = 0;   // Failed to parse for any other reason
 
-    // VALIDATION: Count commas - should have exactly 9 for 10 temperature values
-    char* dataStart = colonPos + 1;
-    int commaCount = 0;
-    for (char* p = dataStart; *p; p++) {
-      if (*p == ',') commaCount++;
+  ReceivedFrame overflowFrame;                    // Drains the FIFO when the queue is full
+
+  static bool isBinaryFrame(const uint8_t* packet, int len) {
+    return len > 0 && packet[0] == FRAME_MAGIC;
+  }
+
+  // Binary frames from current TX firmware, legacy text from older units during rollout
+  bool parsePacket(const uint8_t* packet, int len, TransmitterData* tx, FrameInfo* info) {
+    if (isBinaryFrame(packet, len)) {
+      return parseBinaryFrame(packet, len, tx, info);
     }
-    if (commaCount != 9) {
-      Serial.printf("Invalid comma count: expected 9, got %d\n", commaCount);
-      return false; // Corrupted packet
+
+    info->type = FRAME_TYPE_READINGS;
+    info->sequence = 0;
+    info->mask = (1 << (NUM_TEMP_SENSORS + 1)) - 1;
+    info->batchCount = 0;
+    info->txNumber = 0;
+    tx->maxSilenceMs = 0;
+
+    char error[64];
+    if (!parseTextPacket((const char*)packet, tx, error, sizeof(error))) {
+      if (error[0]) Serial.println(error);
+      return false;
     }
+    tx->lastReceived = millis();
+    tx->active = true;
+    return true;
+  }
 
-    // VALIDATION: Check for double decimals (e.g., "23.3.4")
-    char* p = dataStart;
-    int dotCount = 0;
-    while (*p) {
-      if (*p == '.') {
-        dotCount++;
-        if (dotCount > 1) {
-          Serial.println("Double decimal point detected - corrupted value");
-          return false;
-        }
-      } else if (*p == ',') {
-        dotCount = 0; // Reset for next value
-      }
-      p++;
+  bool parseBinaryFrame(const uint8_t* frame, int len, TransmitterData* tx, FrameInfo* info) {
+    if (len < FRAME_HEADER_SIZE_V1 + FRAME_CRC_SIZE) {
+      Serial.printf("Binary frame too short: %d bytes\n", len);
+      return false;
     }
 
-    // Parse temperatures (9 sensors + 1 ambient = 10 values)
-    int count = 0;
-    char* token = strtok(dataStart, ",");
+    if (!frameCrcValid(frame, len)) {
+      Serial.println("Binary frame CRC mismatch - corrupted packet");
+      crcErrors++;
+      return false;
+    }
 
-    while (token && count < NUM_TEMP_SENSORS) {
-      tx->temps[count] = atof(token);
-      count++;
-      token = strtok(NULL, ",");
+    uint8_t version = frame[1] >> 4;
+    uint8_t type = frame[1] & 0x0F;
+    if (version < 1 || version > FRAME_VERSION ||
+        (type != FRAME_TYPE_READINGS && type != FRAME_TYPE_DELTA && type != FRAME_TYPE_BATCH) ||
+        (type == FRAME_TYPE_BATCH && version < 2)) {
+      Serial.printf("Unsupported frame version %d type %d\n", version, type);
+      return false;
     }
 
-    // Last value is ambient
-    if (token) {
-      tx->ambientTemp = atof(token);
-    } else {
-      return false; // Must have all 10 values
+    // v1 frames have no max-silence byte
+    int headerSize = (version == 1) ? FRAME_HEADER_SIZE_V1 : FRAME_HEADER_SIZE;
+    if (len < headerSize + FRAME_CRC_SIZE) {
+      Serial.printf("Binary frame too short: %d bytes\n", len);
+      return false;
     }
 
-    if (count != NUM_TEMP_SENSORS) return false;
+    uint16_t id = frame[2] | (frame[3] << 8);
+    uint16_t mask = frame[headerSize - 2] | (frame[headerSize - 1] << 8);
+    tx->maxSilenceMs = (version == 1) ? 0 : frame[5] * 10000UL;
+
+    // Bit 0 = ambient, bits 1..NUM_TEMP_SENSORS = positions
+    if (mask & ~((1 << (NUM_TEMP_SENSORS + 1)) - 1)) {
+      Serial.printf("Invalid presence mask 0x%04X\n", mask);
+      return false;
+    }
+
+    int valueCount = frameValueCount(mask);
+
+    info->type = type;
+    info->sequence = frame[4];
+    info->mask = mask;
+    info->batchCount = 0;
+    info->txNumber = id;
+
+    snprintf(tx->txID, sizeof(tx->txID), "TX%u", id);
+
+    if (type == FRAME_TYPE_BATCH) {
+      // Stored readings are decoded one at a time by batchReading()
+      if (len < headerSize + 1 + FRAME_CRC_SIZE ||
+          len != headerSize + 1 + frame[headerSize] * (BATCH_READING_HEADER_SIZE + valueCount * 2) + FRAME_CRC_SIZE) {
+        Serial.printf("Batch frame length %d does not match mask 0x%04X\n", len, mask);
+        return false;
+      }
+      info->batchCount = frame[headerSize];
+      return true;
+    }
+
+    if (len != headerSize + valueCount * 2 + FRAME_CRC_SIZE) {
+      Serial.printf("Frame length %d does not match mask 0x%04X\n", len, mask);
+      return false;
+    }
+
+    decodeValues(frame + headerSize, mask, tx);
 
     tx->lastReceived = millis();
     tx->active = true;
 
     return true;
   }
+
+  // Decode stored reading `index` of a BATCH frame already accepted by parseBinaryFrame
+  // into `reading` (temperatures only), with its original sequence and age in seconds
+  void batchReading(const uint8_t* frame, const FrameInfo* info, int index,
+                    TransmitterData* reading, uint8_t* sequence, uint16_t* ageSeconds) {
+    int valueCount = frameValueCount(info->mask);
+
+    const uint8_t* p = frame + FRAME_HEADER_SIZE + 1 + index * (BATCH_READING_HEADER_SIZE + valueCount * 2);
+    *sequence = p[0];
+    *ageSeconds = p[1] | (p[2] << 8);
+    decodeValues(p + BATCH_READING_HEADER_SIZE, info->mask, reading);
+  }
+
+  // Unpopulated slots read as 0.0, same as the padding in the legacy text format
+  // (for DELTA frames they are simply not copied into the slot, see applyDelta)
+  static void decodeValues(const uint8_t* p, uint16_t mask, TransmitterData* tx) {
+    for (int slot = 0; slot <= NUM_TEMP_SENSORS; slot++) {
+      int16_t centi = 0;
+      if (mask & (1 << slot)) {
+        centi = frameReadCenti(p);
+        p += 2;
+      }
+      storeValue(tx, slot, centi);
+    }
+  }
 };
 
 // ======================== GPS MANAGER ========================
@@ -399,25 +824,6 @@ public:
     }
   }
 
-  // Get Unix timestamp from GPS date/time, or fallback to millis()
-  unsigned long getUnixTimestamp() {
-    if (gps.date.isValid() && gps.time.isValid()) {
-      // Convert GPS date/time to Unix timestamp
-      struct tm timeinfo;
-      timeinfo.tm_year = gps.date.year() - 1900;
-      timeinfo.tm_mon = gps.date.month() - 1;
-      timeinfo.tm_mday = gps.date.day();
-      timeinfo.tm_hour = gps.time.hour();
-      timeinfo.tm_min = gps.time.minute();
-      timeinfo.tm_sec = gps.time.second();
-
-      time_t timestamp = mktime(&timeinfo);
-      return (unsigned long)timestamp;
-    }
-    // Fallback to millis() if GPS time not available
-    return millis() / 1000; // Convert to seconds
-  }
-
   GPSData* getData() { return &data; }
 };
 
@@ -443,39 +849,17 @@ public:
     buzzerState = false;
   }
 
-  void update(TransmitterData transmitters[], int numTx, float warnOffset, float critOffset) {
-    // Check all transmitters for alarm conditions
-    uint8_t maxLevel = 0;
-
-    for (int i = 0; i < numTx; i++) {
-      if (!transmitters[i].active) continue;
-
-      float ambient = transmitters[i].ambientTemp;
-
-      for (int j = 0; j < NUM_TEMP_SENSORS; j++) {
-        float temp = transmitters[i].temps[j];
-        if (temp < 1.0) { // Ignore 0.0 (unused sensors)
-          transmitters[i].alarmLevels[j] = 0;
-          continue;
-        }
-
-        float delta = temp - ambient;
-
-        if (delta >= critOffset) {
-          transmitters[i].alarmLevels[j] = 2;
-          if (maxLevel < 2) maxLevel = 2;
-        } else if (delta >= warnOffset) {
-          transmitters[i].alarmLevels[j] = 1;
-          if (maxLevel < 1) maxLevel = 1;
-        } else {
-          transmitters[i].alarmLevels[j] = 0;
-        }
+  // Drive the buzzer from the cached fleet level; only a threshold change
+  // (from the config page) re-evaluates every active transmitter
+  void update(FleetTable* fleet, float warnOffset, float critOffset) {
+    if (warnOffset != this->warnOffset || critOffset != this->critOffset) {
+      this->warnOffset = warnOffset;
+      this->critOffset = critOffset;
+      for (int n = 0; n < fleet->activeCount; n++) {
+        evaluate(fleet, fleet->activeList[n], false);
       }
     }
 
-    currentAlarmLevel = maxLevel;
-    alarmActive = (maxLevel > 0);
-
     // Handle buzzer patterns
     if (!alarmMuted && !alarmAcknowledged && alarmActive) {
       unsigned long interval = (currentAlarmLevel == 2) ? 500 : 1000;
@@ -491,6 +875,35 @@ public:
     }
   }
 
+  // Re-evaluate one transmitter after a frame was applied to it (newReading),
+  // or with its current reading after a threshold change; O(1) in fleet size
+  void evaluate(FleetTable* fleet, int slot, bool newReading) {
+    TransmitterData* tx = &fleet->slots[slot];
+    AlarmState* state = &fleet->alarms[slot];
+
+    if (newReading) {
+      alarmAddRiseSample(state, tx);
+    }
+    uint8_t maxLevel = alarmEvaluateHubs(tx, state, warnOffset, critOffset);
+
+    clear(fleet, slot);
+    state->level = maxLevel;
+    state->counted = true;
+    levelCounts[maxLevel]++;
+    refreshLevel();
+  }
+
+  // Drop a transmitter from the fleet level (timed out); its hub levels are kept
+  // so hysteresis still holds if it comes back
+  void clear(FleetTable* fleet, int slot) {
+    AlarmState* state = &fleet->alarms[slot];
+    if (state->counted) {
+      levelCounts[state->level]--;
+      state->counted = false;
+      refreshLevel();
+    }
+  }
+
   void muteAlarm() {
     alarmMuted = true;
     digitalWrite(BUZZER_PIN, LOW);
@@ -515,14 +928,63 @@ public:
       default: return ILI9341_GREEN;
     }
   }
+
+private:
+  // Active transmitters at each highest level, so the fleet level is O(1) to maintain
+  int levelCounts[3] = {0, 0, 0};
+  float warnOffset = DEFAULT_WARN_OFFSET;
+  float critOffset = DEFAULT_CRIT_OFFSET;
+
+  void refreshLevel() {
+    currentAlarmLevel = levelCounts[2] ? 2 : (levelCounts[1] ? 1 : 0);
+    alarmActive = (currentAlarmLevel > 0);
+  }
 };
 
 // ======================== SD LOGGER ========================
+// Fixed-width row of a binary log (SD_LOG_BINARY), converted back to CSV on the
+// host by tools/sd_log_to_csv.py - keep the two in step
+struct __attribute__((packed)) LogRecord {
+  uint32_t timestamp;                   // millis() the reading was taken at
+  uint32_t utc;                         // Unix seconds of the same moment, 0 = clock not synced
+  int32_t latitudeE6;                   // Degrees * 1e6, LOG_NO_POSITION when unknown
+  int32_t longitudeE6;
+  char txID[16];
+  int16_t tempCenti[NUM_TEMP_SENSORS];  // 0.01 °C
+  int16_t ambientCenti;
+  int16_t rssi;
+  uint16_t speedDeciKmh;
+  uint8_t satellites;
+  uint8_t alarmLevels[NUM_TEMP_SENSORS];
+};
+
+// Start of every binary log file
+struct __attribute__((packed)) LogFileHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recordSize;
+  uint8_t sensorCount;
+  uint8_t reserved[3];
+};
+
+#define LOG_FILE_MAGIC    0x474C5741  // "AWLG"
+#define LOG_FILE_VERSION  2
+#define LOG_NO_POSITION   INT32_MIN
+
+// Rows collect in RAM and reach the card in whole sectors, through a file that
+// stays open, so a packet costs a memcpy instead of an open, size check, ~40 small
+// writes and a FAT update on the SPI bus the display and touch share.
+// Files rotate daily (GPS date) and at SD_LOG_MAX_FILE_BYTES
 class SDLogger {
 public:
   bool sdAvailable;
   File logFile;
 
+  // Statistics
+  unsigned long rowsLogged = 0;
+  unsigned long flushCount = 0;
+  unsigned long bytesDropped = 0;  // Lost to a failed card write
+
   void begin() {
 #if ENABLE_SD_CARD
     Serial.println("Initializing SD card...");
@@ -553,6 +1015,8 @@ public:
         case CARD_SDHC: Serial.println("SDHC"); break;
         default: Serial.println("UNKNOWN"); break;
       }
+
+      if (!SD.exists(SD_LOG_DIR)) SD.mkdir(SD_LOG_DIR);
     } else {
       Serial.println("  WARNING: SD card not detected or init failed");
       Serial.println("  Continuing without SD card logging...");
@@ -565,19 +1029,155 @@ public:
 #endif
   }
 
-  void logData(TransmitterData* tx, GPSData* gpsData, int rssi) {
+  // timestamp is the millis() the reading was taken at, utcMs the same moment on the
+  // ClockService (0 = unknown); gpsData may be null when the position at that time is
+  // unknown (backfilled readings), leaving those fields empty
+  void logData(TransmitterData* tx, GPSData* gpsData, int rssi, unsigned long timestamp, uint64_t utcMs) {
     if (!sdAvailable) return;
 
-    // Open log file in append mode
-    logFile = SD.open("/axlewatch_log.csv", FILE_APPEND);
-    if (!logFile) {
+#if SD_LOG_BINARY
+    LogRecord record;
+    memset(&record, 0, sizeof(record));
+    record.timestamp = timestamp;
+    record.utc = utcMs / 1000;
+    strncpy(record.txID, tx->txID, sizeof(record.txID) - 1);
+    for (int i = 0; i < NUM_TEMP_SENSORS; i++) {
+      record.tempCenti[i] = (int16_t)constrain(lroundf(tx->temps[i] * 100), -32768, 32767);
+      record.alarmLevels[i] = tx->alarmLevels[i];
+    }
+    record.ambientCenti = (int16_t)constrain(lroundf(tx->ambientTemp * 100), -32768, 32767);
+    record.rssi = rssi;
+    if (gpsData) {
+      record.latitudeE6 = lround(gpsData->latitude * 1e6);
+      record.longitudeE6 = lround(gpsData->longitude * 1e6);
+      record.speedDeciKmh = (uint16_t)constrain(lroundf(gpsData->speedKmh * 10), 0, 65535);
+      record.satellites = gpsData->satellites;
+    } else {
+      record.latitudeE6 = record.longitudeE6 = LOG_NO_POSITION;
+    }
+    append(&record, sizeof(record));
+#else
+    // Timestamp,UTC,TxID,Temp1..N,Ambient,Lat,Lon,Speed,Sats,RSSI,Alarm1..N,
+    char utc[24];
+    ClockService::formatIso(utcMs, utc, sizeof(utc));
+    char row[256];
+    int len = snprintf(row, sizeof(row), "%lu,%s,%s,", timestamp, utc, tx->txID);
+    // Empty field for a sensor fault
+    for (int i = 0; i <= NUM_TEMP_SENSORS; i++) {
+      float temp = (i < NUM_TEMP_SENSORS) ? tx->temps[i] : tx->ambientTemp;
+      len += tempFault(temp) ? snprintf(row + len, sizeof(row) - len, ",")
+                             : snprintf(row + len, sizeof(row) - len, "%.1f,", temp);
+    }
+    if (gpsData) {
+      len += snprintf(row + len, sizeof(row) - len, "%.6f,%.6f,%.1f,%d,",
+                      gpsData->latitude, gpsData->longitude, gpsData->speedKmh, gpsData->satellites);
+    } else {
+      len += snprintf(row + len, sizeof(row) - len, ",,,,");
+    }
+    len += snprintf(row + len, sizeof(row) - len, "%d,", rssi);
+    for (int i = 0; i < NUM_TEMP_SENSORS; i++) {
+      len += snprintf(row + len, sizeof(row) - len, "%u,", tx->alarmLevels[i]);
+    }
+    len += snprintf(row + len, sizeof(row) - len, "\r\n");
+    append(row, len);
+#endif
+
+    rowsLogged++;
+    if (buffered >= SD_LOG_FLUSH_BYTES) flush(false);
+  }
+
+  // Called from loop(): writes out rows that have waited SD_LOG_FLUSH_MS
+  void update(unsigned long now) {
+    if (buffered > 0 && now - firstBufferedAt >= SD_LOG_FLUSH_MS) flush(true);
+  }
+
+private:
+  uint8_t buffer[SD_LOG_BUFFER_SIZE];
+  size_t buffered = 0;
+  unsigned long firstBufferedAt = 0;  // When the oldest unwritten row arrived
+  uint32_t fileDate = 0;              // GPS date (YYYYMMDD, 0 = none yet) of logFile
+
+  void append(const void* data, size_t len) {
+    if (buffered + len > sizeof(buffer)) flush(true);
+    if (buffered + len > sizeof(buffer)) {
+      bytesDropped += len;
+      return;
+    }
+    if (buffered == 0) firstBufferedAt = millis();
+    memcpy(buffer + buffered, data, len);
+    buffered += len;
+  }
+
+  // all = false: write only up to the next sector boundary of the file and keep
+  // the rest, so size-triggered writes never split a sector. The timer flush
+  // writes everything (at most one partial sector, realigned by the next flush)
+  void flush(bool all) {
+    if (!openLogFile()) {
       Serial.println("Failed to open log file");
+      bytesDropped += buffered;
+      buffered = 0;
       return;
     }
 
-    // Check if file is new (write header)
+    size_t fileSize = logFile.size();
+    size_t n = buffered;
+    if (!all) {
+      size_t end = (fileSize + buffered) / SD_SECTOR_SIZE * SD_SECTOR_SIZE;
+      n = end > fileSize ? end - fileSize : 0;
+      if (n == 0) return;
+    }
+
+    int64_t started = esp_timer_get_time();
+    size_t written = logFile.write(buffer, n);
+    logFile.flush();  // One directory update per flush, so a power cut loses at most one buffer
+    perfRecord(PERF_SD_WRITE, started);
+    flushCount++;
+    if (written != n) {
+      Serial.println("Failed to write log file");
+      bytesDropped += buffered;
+      buffered = 0;
+      logFile.close();  // Reopened (and rotated) on the next flush
+      return;
+    }
+
+    buffered -= n;
+    memmove(buffer, buffer + n, buffered);
+    if (buffered > 0) firstBufferedAt = millis();
+  }
+
+  static uint32_t gpsDate() {
+    if (!gps.date.isValid() || gps.date.year() < 2020) return 0;
+    return gps.date.year() * 10000UL + gps.date.month() * 100 + gps.date.day();
+  }
+
+  // Keep logFile open on today's file, rotating at midnight and at the size limit
+  bool openLogFile() {
+    uint32_t date = gpsDate();
+    if (logFile && (date != fileDate || logFile.size() >= SD_LOG_MAX_FILE_BYTES)) {
+      logFile.close();
+    }
+    if (logFile) return true;
+
+    // First unused /logs/<date>_<n> - a reboot starts a new file rather than
+    // appending to one that may end in a torn row
+    char path[40];
+    for (int index = 0; index < 1000; index++) {
+      snprintf(path, sizeof(path), "%s/%08lu_%03d.%s", SD_LOG_DIR, (unsigned long)date, index,
+               SD_LOG_BINARY ? "bin" : "csv");
+      if (!SD.exists(path)) break;
+    }
+
+    logFile = SD.open(path, FILE_APPEND);
+    if (!logFile) return false;
+    fileDate = date;
+    Serial.printf("SD log: %s\n", path);
+
     if (logFile.size() == 0) {
-      logFile.print("Timestamp,TxID,");
+#if SD_LOG_BINARY
+      LogFileHeader header = {LOG_FILE_MAGIC, LOG_FILE_VERSION, sizeof(LogRecord), NUM_TEMP_SENSORS, {0, 0, 0}};
+      logFile.write((const uint8_t*)&header, sizeof(header));
+#else
+      logFile.print("Timestamp,UTC,TxID,");
       for (int i = 0; i < NUM_TEMP_SENSORS; i++) {
         logFile.print("Temp");
         logFile.print(i + 1);
@@ -590,50 +1190,47 @@ public:
         logFile.print(",");
       }
       logFile.println();
+#endif
     }
-
-    // Write data row
-    logFile.print(millis());
-    logFile.print(",");
-    logFile.print(tx->txID);
-    logFile.print(",");
-
-    for (int i = 0; i < NUM_TEMP_SENSORS; i++) {
-      logFile.print(tx->temps[i], 1);
-      logFile.print(",");
-    }
-
-    logFile.print(tx->ambientTemp, 1);
-    logFile.print(",");
-    logFile.print(gpsData->latitude, 6);
-    logFile.print(",");
-    logFile.print(gpsData->longitude, 6);
-    logFile.print(",");
-    logFile.print(gpsData->speedKmh, 1);
-    logFile.print(",");
-    logFile.print(gpsData->satellites);
-    logFile.print(",");
-    logFile.print(rssi);
-    logFile.print(",");
-
-    for (int i = 0; i < NUM_TEMP_SENSORS; i++) {
-      logFile.print(tx->alarmLevels[i]);
-      logFile.print(",");
-    }
-
-    logFile.println();
-    logFile.close();
+    return true;
   }
 };
 
 // ======================== DISPLAY MANAGER ========================
+// One retained text cell of the main screen: redrawn only when its text or colour
+// changes, rendered off-screen and pushed through a single address window, so a
+// value never flickers through a cleared background
+struct DisplayCell {
+  int16_t x, y, w, h;
+  uint8_t textSize;
+  bool drawn;
+  uint16_t color;
+  char text[24];
+};
+
+enum DisplayCellId {
+  CELL_WIFI, CELL_GPS, CELL_TX_ID, CELL_RSSI, CELL_AMBIENT, CELL_SPEED,
+  CELL_HUB_FIRST,
+  CELL_COUNT = CELL_HUB_FIRST + NUM_TEMP_SENSORS
+};
+
+// Main screen layout: what each cell was last drawn with
+enum DisplayLayout { LAYOUT_NONE, LAYOUT_NO_TX, LAYOUT_TX };
+
 class DisplayManager {
 public:
   int currentTxIndex;
   unsigned long lastCycleTime;
   unsigned long lastDisplayUpdate;
   bool autoCycle;
-  bool needsRedraw;
+  bool needsRedraw;  // Check for changes now instead of at the next DISPLAY_REFRESH_MS
+
+  // SPI cost of the last refresh (pixels pushed, time spent)
+  uint32_t lastFramePixels = 0;
+  unsigned long lastFrameUs = 0;
+  unsigned long maxFrameUs = 0;
+
+  DisplayManager() : canvas(DISPLAY_CELL_MAX_W, DISPLAY_CELL_MAX_H) {}
 
   void begin() {
     Serial.println("Initializing display...");
@@ -656,34 +1253,42 @@ public:
     autoCycle = true;
     needsRedraw = true;
 
+    canvas.setTextWrap(false);
+    defineCells();
+
     Serial.println("Display initialized");
     delay(100); // Allow display to stabilize
   }
 
-  void update(TransmitterData transmitters[], int numTx, GPSData* gpsData,
+  void update(FleetTable* fleet, GPSData* gpsData,
               AlarmManager* alarmMgr, bool wifiConnected, unsigned long uptimeMs) {
 
     // Auto-cycle through active transmitters
     if (autoCycle && millis() - lastCycleTime >= DISPLAY_CYCLE_INTERVAL) {
-      cycleTx(transmitters, numTx);
+      cycleTx(fleet);
       lastCycleTime = millis();
       needsRedraw = true;
     }
 
-    // Limit display refresh rate to reduce flicker (update every 2 seconds or when needed)
-    if (needsRedraw || (millis() - lastDisplayUpdate >= 2000)) {
-      drawMainScreen(transmitters, numTx, gpsData, alarmMgr, wifiConnected, uptimeMs);
+    // Only changed cells reach the panel, so checking often costs next to nothing
+    if (needsRedraw || (millis() - lastDisplayUpdate >= DISPLAY_REFRESH_MS)) {
+      unsigned long started = micros();
+      framePixels = 0;
+      drawMainScreen(fleet, gpsData, alarmMgr, wifiConnected, uptimeMs);
+      lastFramePixels = framePixels;
+      lastFrameUs = micros() - started;
+      perfStages[PERF_DISPLAY].record(lastFrameUs);
+      if (lastFrameUs > maxFrameUs) maxFrameUs = lastFrameUs;
       lastDisplayUpdate = millis();
       needsRedraw = false;
     }
   }
 
-  void cycleTx(TransmitterData transmitters[], int numTx) {
-    int startIdx = currentTxIndex;
-    do {
-      currentTxIndex = (currentTxIndex + 1) % MAX_TRANSMITTERS;
-      if (transmitters[currentTxIndex].active) break;
-    } while (currentTxIndex != startIdx);
+  // Step to the next active transmitter (the first one if the shown one went inactive)
+  void cycleTx(FleetTable* fleet) {
+    if (fleet->activeCount == 0) return;
+    int pos = fleet->activeIndex(currentTxIndex);
+    currentTxIndex = fleet->activeList[(pos + 1) % fleet->activeCount];
   }
 
   void pauseAutoCycle() {
@@ -695,8 +1300,9 @@ public:
     lastCycleTime = millis();
   }
 
-  void drawMainScreen(TransmitterData transmitters[], int numTx, GPSData* gpsData,
+  void drawMainScreen(FleetTable* fleet, GPSData* gpsData,
                       AlarmManager* alarmMgr, bool wifiConnected, unsigned long uptimeMs) {
+    TransmitterData* transmitters = fleet->slots;
 
     static bool firstDraw = true;
     if (firstDraw) {
@@ -704,107 +1310,44 @@ public:
       firstDraw = false;
     }
 
-    tft.fillScreen(ILI9341_BLACK);
-
-    // Header
-    tft.setTextSize(2);
-    tft.setTextColor(ILI9341_CYAN);
-    tft.setCursor(5, 5);
-    tft.print("AxleWatch");
+    bool txShown = fleet->activeCount > 0 && transmitters[currentTxIndex].active;
+    DisplayLayout wanted = txShown ? LAYOUT_TX : LAYOUT_NO_TX;
+    if (layout != wanted) drawLayout(wanted);
 
-    // WiFi status
-    tft.setTextSize(1);
-    tft.setCursor(250, 8);
+    // WiFi / GPS status
     if (wifiConnected) {
-      tft.setTextColor(ILI9341_GREEN);
-      tft.print("WiFi OK");
+      setCell(CELL_WIFI, ILI9341_GREEN, "WiFi OK");
     } else {
-      tft.setTextColor(ILI9341_RED);
-      tft.print("No WiFi");
+      setCell(CELL_WIFI, ILI9341_RED, "No WiFi");
     }
-
-    // GPS status
-    tft.setCursor(250, 18);
     if (gpsData->validFix) {
-      tft.setTextColor(ILI9341_GREEN);
-      tft.print("GPS OK");
+      setCell(CELL_GPS, ILI9341_GREEN, "GPS OK");
     } else {
-      tft.setTextColor(ILI9341_ORANGE);
-      tft.print("GPS...");
+      setCell(CELL_GPS, ILI9341_ORANGE, "GPS...");
     }
 
-    // Active transmitter
-    if (!transmitters[currentTxIndex].active) {
-      tft.setTextSize(2);
-      tft.setTextColor(ILI9341_YELLOW);
-      tft.setCursor(60, 100);
-      tft.print("No Active TX");
-      drawButtons(alarmMgr);
-      return;
-    }
-
-    TransmitterData* tx = &transmitters[currentTxIndex];
-
-    // TX ID
-    tft.setTextSize(2);
-    tft.setTextColor(ILI9341_WHITE);
-    tft.setCursor(5, 30);
-    tft.print("TX: ");
-    tft.print(tx->txID);
+    if (txShown) {
+      TransmitterData* tx = &transmitters[currentTxIndex];
 
-    // RSSI
-    tft.setTextSize(1);
-    tft.setCursor(200, 35);
-    tft.print("RSSI:");
-    tft.print(tx->rssi);
-    tft.print("dBm");
-
-    // Ambient temp
-    tft.setCursor(5, 50);
-    tft.setTextColor(ILI9341_CYAN);
-    tft.print("Ambient: ");
-    tft.print(tx->ambientTemp, 1);
-    tft.print("C");
-
-    // GPS Speed
-    tft.setCursor(200, 50);
-    tft.setTextColor(ILI9341_CYAN);
-    tft.print("Speed:");
-    tft.print(gpsData->speedKmh, 0);
-    tft.print("km/h");
-
-    // Temperature grid (3x3)
-    int startY = 70;
-    int rowHeight = 40;
-    int colWidth = 106;
-
-    for (int row = 0; row < 3; row++) {
-      for (int col = 0; col < 3; col++) {
-        int idx = row * 3 + col;
-        int x = col * colWidth + 5;
-        int y = startY + row * rowHeight;
-
-        // Position label
-        tft.setTextSize(1);
-        tft.setTextColor(ILI9341_WHITE);
-        tft.setCursor(x, y);
-        tft.print("P");
-        tft.print(idx + 1);
-        tft.print(":");
+      setCell(CELL_TX_ID, ILI9341_WHITE, "TX: %s", tx->txID);
+      setCell(CELL_RSSI, ILI9341_WHITE, "RSSI:%ddBm", tx->rssi);
+      if (tempFault(tx->ambientTemp)) {
+        setCell(CELL_AMBIENT, ILI9341_ORANGE, "Ambient: ERR");
+      } else {
+        setCell(CELL_AMBIENT, ILI9341_CYAN, "Ambient: %.1fC", tx->ambientTemp);
+      }
+      setCell(CELL_SPEED, ILI9341_CYAN, "Speed:%.0fkm/h", gpsData->speedKmh);
 
-        // Temperature value
+      // Temperature grid (3x3), coloured by alarm level
+      for (int idx = 0; idx < NUM_TEMP_SENSORS; idx++) {
         float temp = tx->temps[idx];
         uint16_t color = alarmMgr->getAlarmColor(tx->alarmLevels[idx]);
-
-        tft.setTextSize(2);
-        tft.setTextColor(color);
-        tft.setCursor(x, y + 12);
-
-        if (temp < 1.0) {
-          tft.print("--");
+        if (tempFault(temp)) {
+          setCell(CELL_HUB_FIRST + idx, ILI9341_ORANGE, "ERR");
+        } else if (temp < 1.0) {
+          setCell(CELL_HUB_FIRST + idx, color, "--");
         } else {
-          if (temp < 100) tft.print(" ");
-          tft.print(temp, 1);
+          setCell(CELL_HUB_FIRST + idx, color, temp < 100 ? " %.1f" : "%.1f", temp);
         }
       }
     }
@@ -813,7 +1356,12 @@ public:
     drawButtons(alarmMgr);
   }
 
+  // Buttons only change with the mute / acknowledge state
   void drawButtons(AlarmManager* alarmMgr) {
+    int8_t muted = alarmMgr->alarmMuted;
+    int8_t acked = alarmMgr->alarmAcknowledged;
+    if (muted == shownMuted && acked == shownAcked) return;
+
     int btnY = 210;
 
     // Mute button
@@ -830,11 +1378,123 @@ public:
     tft.setCursor(135, btnY + 8);
     tft.print("ACK");
 
-    // Settings button (placeholder)
-    tft.fillRect(230, btnY, 80, 25, ILI9341_GREEN);
-    tft.drawRect(230, btnY, 80, 25, ILI9341_WHITE);
-    tft.setCursor(240, btnY + 8);
-    tft.print("SETTINGS");
+    // Settings button (placeholder, only drawn with the layout)
+    if (shownMuted < 0) {
+      tft.fillRect(230, btnY, 80, 25, ILI9341_GREEN);
+      tft.drawRect(230, btnY, 80, 25, ILI9341_WHITE);
+      tft.setCursor(240, btnY + 8);
+      tft.print("SETTINGS");
+      framePixels += 80 * 25;
+    }
+    framePixels += 2 * 90 * 25;
+
+    shownMuted = muted;
+    shownAcked = acked;
+  }
+
+private:
+  GFXcanvas16 canvas;  // Off-screen buffer a cell is rendered into before the push
+  DisplayCell cells[CELL_COUNT];
+  DisplayLayout layout = LAYOUT_NONE;
+  int8_t shownMuted = -1;  // Button states on screen, -1 = not drawn
+  int8_t shownAcked = -1;
+  uint32_t framePixels = 0;
+
+  void defineCell(int id, int16_t x, int16_t y, int16_t w, uint8_t textSize) {
+    DisplayCell& cell = cells[id];
+    cell.x = x;
+    cell.y = y;
+    cell.w = w < DISPLAY_CELL_MAX_W ? w : DISPLAY_CELL_MAX_W;
+    cell.h = 8 * textSize;
+    cell.textSize = textSize;
+    cell.drawn = false;
+  }
+
+  // Same positions as the old full-screen drawing
+  void defineCells() {
+    defineCell(CELL_WIFI, 250, 8, 60, 1);
+    defineCell(CELL_GPS, 250, 18, 60, 1);
+    defineCell(CELL_TX_ID, 5, 30, 190, 2);
+    defineCell(CELL_RSSI, 200, 35, 115, 1);
+    defineCell(CELL_AMBIENT, 5, 50, 190, 1);
+    defineCell(CELL_SPEED, 200, 50, 115, 1);
+
+    int startY = 70;
+    int rowHeight = 40;
+    int colWidth = 106;
+    for (int idx = 0; idx < NUM_TEMP_SENSORS; idx++) {
+      int x = (idx % 3) * colWidth + 5;
+      int y = startY + (idx / 3) * rowHeight;
+      defineCell(CELL_HUB_FIRST + idx, x, y + 12, 72, 2);
+    }
+  }
+
+  // Clear the screen and draw what never changes for this layout; every cell
+  // and button is drawn again on this refresh
+  void drawLayout(DisplayLayout wanted) {
+    tft.fillScreen(ILI9341_BLACK);
+    framePixels += 320 * 240;
+
+    // Header
+    tft.setTextSize(2);
+    tft.setTextColor(ILI9341_CYAN);
+    tft.setCursor(5, 5);
+    tft.print("AxleWatch");
+
+    if (wanted == LAYOUT_NO_TX) {
+      tft.setTextSize(2);
+      tft.setTextColor(ILI9341_YELLOW);
+      tft.setCursor(60, 100);
+      tft.print("No Active TX");
+    } else {
+      // Position labels
+      int startY = 70;
+      int rowHeight = 40;
+      int colWidth = 106;
+      tft.setTextSize(1);
+      tft.setTextColor(ILI9341_WHITE);
+      for (int idx = 0; idx < NUM_TEMP_SENSORS; idx++) {
+        tft.setCursor((idx % 3) * colWidth + 5, startY + (idx / 3) * rowHeight);
+        tft.print("P");
+        tft.print(idx + 1);
+        tft.print(":");
+      }
+    }
+
+    for (int i = 0; i < CELL_COUNT; i++) cells[i].drawn = false;
+    shownMuted = shownAcked = -1;
+    layout = wanted;
+  }
+
+  void setCell(int id, uint16_t color, const char* format, ...) {
+    char text[sizeof(cells[0].text)];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+
+    DisplayCell& cell = cells[id];
+    if (cell.drawn && cell.color == color && strcmp(cell.text, text) == 0) return;
+
+    canvas.fillRect(0, 0, cell.w, cell.h, ILI9341_BLACK);
+    canvas.setTextSize(cell.textSize);
+    canvas.setTextColor(color);
+    canvas.setCursor(0, 0);
+    canvas.print(text);
+
+    // Canvas rows are DISPLAY_CELL_MAX_W wide, the window only cell.w
+    uint16_t* pixels = canvas.getBuffer();
+    tft.startWrite();
+    tft.setAddrWindow(cell.x, cell.y, cell.w, cell.h);
+    for (int row = 0; row < cell.h; row++) {
+      tft.writePixels(pixels + row * DISPLAY_CELL_MAX_W, cell.w);
+    }
+    tft.endWrite();
+    framePixels += cell.w * cell.h;
+
+    cell.drawn = true;
+    cell.color = color;
+    strcpy(cell.text, text);
   }
 };
 
@@ -947,8 +1607,12 @@ enum WiFiState {
 
 // Extern declarations for global variables (defined later in file)
 extern GPSManager gpsManager;
-extern TransmitterData transmitters[];
+extern TransmitterData* transmitters;
+extern LinkStats* linkStats;
+extern LoRaManager loraManager;
 extern WiFiState wifiState;
+extern DisplayManager displayManager;
+extern SDLogger sdLogger;
 
 // ======================== WEB CONFIG SERVER ========================
 class WebConfigServer {
@@ -963,80 +1627,59 @@ public:
   }
 
   void setupRoutes() {
-    webServer.on("/", [this]() { handleRoot(); });
-    webServer.on("/save", HTTP_POST, [this]() { handleSave(); });
-    webServer.on("/status", [this]() { handleStatus(); });
-    webServer.on("/live", [this]() { handleLive(); });
-    webServer.on("/api/live", [this]() { handleApiLive(); });
-    webServer.on("/api/config", [this]() { handleApiConfig(); });
-    webServer.on("/api/upload/status", [this]() { handleUploadStatus(); });
-    webServer.on("/wifi/status", [this]() { handleWifiStatus(); });
+    // Each handler is timed into PERF_WEB
+    webServer.on("/", [this]() { timed(&WebConfigServer::handleRoot); });
+    webServer.on("/save", HTTP_POST, [this]() { timed(&WebConfigServer::handleSave); });
+    webServer.on("/status", [this]() { timed(&WebConfigServer::handleStatus); });
+    webServer.on("/live", [this]() { timed(&WebConfigServer::handleLive); });
+    webServer.on("/api/live", [this]() { timed(&WebConfigServer::handleApiLive); });
+    webServer.on("/api/config", [this]() { timed(&WebConfigServer::handleApiConfig); });
+    webServer.on("/api/upload/status", [this]() { timed(&WebConfigServer::handleUploadStatus); });
+    webServer.on("/api/lora", [this]() { timed(&WebConfigServer::handleApiLora); });
+    webServer.on("/api/events", [this]() { timed(&WebConfigServer::handleEvents); });
+    webServer.on("/api/perf", [this]() { timed(&WebConfigServer::handleApiPerf); });
+
+    // Needed to answer revalidation of the cached pages with 304
+    const char* headerKeys[] = {"If-None-Match"};
+    webServer.collectHeaders(headerKeys, 1);
+    webServer.on("/wifi/status", [this]() { timed(&WebConfigServer::handleWifiStatus); });
     webServer.begin();
     Serial.println("Web server started");
   }
 
   void handleClient() {
     webServer.handleClient();
+    publishEvents();
   }
 
-  void handleRoot() {
-    String html = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-  <title>AxleWatch Config</title>
-  <meta name="viewport" content="width=device-width, initial-scale=1">
-  <style>
-    body { font-family: Arial; margin: 20px; background: #f0f0f0; }
-    .container { max-width: 600px; margin: auto; background: white; padding: 20px; border-radius: 8px; }
-    h1 { color: #2196F3; }
-    label { display: block; margin-top: 15px; font-weight: bold; }
-    input, button { width: 100%; padding: 10px; margin-top: 5px; box-sizing: border-box; }
-    button { background: #2196F3; color: white; border: none; cursor: pointer; font-size: 16px; }
-    button:hover { background: #0b7dda; }
-    .status { background: #e7f3ff; padding: 10px; border-left: 4px solid #2196F3; margin-bottom: 20px; }
-  </style>
-</head>
-<body>
-  <div class="container">
-    <h1>AxleWatch Receiver Configuration</h1>
-    <div class="status">
-      <strong>Device ID:</strong> )rawliteral" + String(configMgr->config.deviceID) + R"rawliteral(<br>
-      <strong>Status:</strong> Configuration Mode<br>
-      <strong><a href="/live" style="color: #2196F3;">View Live Dashboard →</a></strong>
-    </div>
-    <form action="/save" method="POST">
-      <label>WiFi SSID:</label>
-      <input type="text" name="ssid" value=")rawliteral" + String(configMgr->config.wifiSSID) + R"rawliteral(" required>
-
-      <label>WiFi Password:</label>
-      <input type="password" name="password" value=")rawliteral" + String(configMgr->config.wifiPassword) + R"rawliteral(">
-
-      <label>Cloud Endpoint URL:</label>
-      <input type="text" name="endpoint" value=")rawliteral" + String(configMgr->config.cloudEndpoint) + R"rawliteral(">
-
-      <label>Cloud API Key:</label>
-      <input type="password" name="apiKey" value=")rawliteral" + String(configMgr->config.apiKey) + R"rawliteral(" placeholder="Enter API key from axlewatch.com">
-
-      <label>Warning Threshold (°C above ambient):</label>
-      <input type="number" step="0.1" name="warnOffset" value=")rawliteral" + String(configMgr->config.warnOffset) + R"rawliteral(">
-
-      <label>Critical Threshold (°C above ambient):</label>
-      <input type="number" step="0.1" name="critOffset" value=")rawliteral" + String(configMgr->config.critOffset) + R"rawliteral(">
-
-      <label>
-        <input type="checkbox" name="cloudEnabled" value="1" )rawliteral" + String(configMgr->config.cloudEnabled ? "checked" : "") + R"rawliteral(>
-        Enable Cloud Upload
-      </label>
-
-      <button type="submit">Save Configuration</button>
-    </form>
-  </div>
-</body>
-</html>
-)rawliteral";
-
-    webServer.send(200, "text/html", html);
+  void timed(void (WebConfigServer::*handler)()) {
+    int64_t started = esp_timer_get_time();
+    (this->*handler)();
+    perfRecord(PERF_WEB, started);
+  }
+
+  // Mark a transmitters[] slot as changed; pushed to /live on the next handleClient()
+  void notifyTransmitter(int slot) {
+    if (pendingCount < EVENT_MAX_PENDING) pendingSlots[pendingCount++] = slot;
+  }
+
+  void handleRoot() {
+    sendStaticPage(RX_CONFIG_HTML_GZ, RX_CONFIG_HTML_GZ_LEN, RX_CONFIG_HTML_ETAG);
+  }
+
+  // Send a gzipped page from flash, or 304 if the browser's copy is current
+  // Page URLs stay the same across firmware updates, so browsers are told to
+  // revalidate every time - that round trip carries only headers
+  void sendStaticPage(const uint8_t* gz, size_t len, const char* etag) {
+    webServer.sendHeader("ETag", etag);
+    webServer.sendHeader("Cache-Control", "no-cache");
+    if (webServer.header("If-None-Match") == etag) {
+      webServer.send(304);
+      return;
+    }
+
+    webServer.sendHeader("Content-Encoding", "gzip");
+    webServer.send_P(200, "text/html", (PGM_P)gz, len);
   }
 
   void handleSave() {
@@ -1045,7 +1688,8 @@ public:
               sizeof(configMgr->config.wifiSSID) - 1);
     }
 
-    if (webServer.hasArg("password")) {
+    // The config page never receives the saved secrets, so blank means unchanged
+    if (webServer.hasArg("password") && webServer.arg("password").length() > 0) {
       strncpy(configMgr->config.wifiPassword, webServer.arg("password").c_str(),
               sizeof(configMgr->config.wifiPassword) - 1);
     }
@@ -1055,7 +1699,7 @@ public:
               sizeof(configMgr->config.cloudEndpoint) - 1);
     }
 
-    if (webServer.hasArg("apiKey")) {
+    if (webServer.hasArg("apiKey") && webServer.arg("apiKey").length() > 0) {
       strncpy(configMgr->config.apiKey, webServer.arg("apiKey").c_str(),
               sizeof(configMgr->config.apiKey) - 1);
     }
@@ -1068,6 +1712,11 @@ public:
       configMgr->config.critOffset = webServer.arg("critOffset").toFloat();
     }
 
+    if (webServer.hasArg("replayBudget")) {
+      long budget = webServer.arg("replayBudget").toInt();
+      configMgr->config.replayBudget = budget > 0 ? budget : 0;
+    }
+
     configMgr->config.cloudEnabled = webServer.hasArg("cloudEnabled");
 
     configMgr->saveConfig();
@@ -1112,34 +1761,308 @@ public:
   void handleApiLive();      // Live data JSON API
   void handleApiConfig();    // Configuration JSON API
   void handleWifiStatus();   // WiFi status JSON API
+  void handleApiLora();      // LoRa channel / collision statistics JSON API
+  void handleApiPerf();      // Stage timings, duty cycle and memory JSON API
+  void handleEvents();       // Server-sent event stream for /live
+  void publishEvents();
+  void sendEvent(const char* name, const char* data, size_t len);
+
+  // Event stream clients (sockets kept open after their /api/events request)
+  WiFiClient eventClients[EVENT_MAX_CLIENTS];
+  uint16_t pendingSlots[EVENT_MAX_PENDING];  // transmitters[] slots not yet pushed (may repeat)
+  int pendingCount = 0;
+  unsigned long lastEventSent = 0;
 };
 
 // ======================== CLOUD UPLOAD MANAGER ========================
+// One trailer reading as uploaded, in the compact form the offline spool keeps.
+// loop() copies these out of the fleet table, so the upload task never reads slots
+// the LoRa path is writing
+struct __attribute__((packed)) UploadRecord {
+  uint32_t time;           // Unix seconds at capture, or uptime seconds | UPLOAD_TIME_UPTIME
+                           // while the clock was not synced (converted in startBatch)
+  int32_t latitudeE6;      // GPS position at capture, degrees * 1e6
+  int32_t longitudeE6;
+  char txID[16];
+  int16_t hubCenti[8];     // Hub temperatures in 0.01 °C
+  int16_t ambientCenti;
+  uint16_t speedDeciKmh;
+};  // 48 bytes, fields naturally aligned
+
+// Header of SPOOL_FILE, followed by UploadRecords
+struct SpoolFileHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recordSize;
+  uint32_t readIndex;      // Records before this one have been uploaded
+};
+
+#define SPOOL_FILE_MAGIC    0x50535741  // "AWSP"
+#define SPOOL_FILE_VERSION  2           // v2: UploadRecord.time is UTC
+#define UPLOAD_TIME_UPTIME  0x80000000  // UploadRecord.time flag, see above
+
+// Readings the cloud has not accepted yet, oldest first. A RAM ring (PSRAM when
+// fitted) takes them; when it fills, its oldest SPOOL_FLUSH_RECORDS move to SPOOL_FILE,
+// so the file always holds the oldest part of the backlog. Used from loop() only:
+// the SD card shares its SPI bus with the display
+class TelemetrySpool {
+public:
+  uint32_t dropped = 0;  // Records lost because the RAM ring and the SD file were both full
+  uint32_t undated = 0;  // Records dropped because no UTC can ever be given to them
+
+  void begin(bool useSD) {
+    capacity = psramFound() ? SPOOL_RAM_RECORDS_PSRAM : SPOOL_RAM_RECORDS_INTERNAL;
+    ring = (UploadRecord*)(psramFound() ? ps_calloc(capacity, sizeof(UploadRecord))
+                                        : calloc(capacity, sizeof(UploadRecord)));
+    if (!ring) capacity = 0;
+
+    sdEnabled = useSD;
+    if (sdEnabled) openFile();  // Resume a backlog left by the last run
+
+    Serial.printf("Upload spool: %d records in %s, %lu on SD\n", capacity,
+                  psramFound() ? "PSRAM" : "internal RAM", (unsigned long)sdDepth());
+  }
+
+  uint32_t depth() const { return ramCount + sdDepth(); }
+  uint32_t sdDepth() const { return sdCount - sdRead; }
+  bool empty() const { return depth() == 0; }
+
+  // Capture time of the oldest waiting record (0 when empty)
+  uint32_t oldestTime() const {
+    if (sdDepth() > 0) return sdHeadTime;
+    return ramCount > 0 ? ring[head].time : 0;
+  }
+
+  void push(const UploadRecord& record) {
+    if (capacity == 0) {
+      dropped++;
+      return;
+    }
+    if (ramCount == capacity) makeRoom();
+    ring[(head + ramCount) % capacity] = record;
+    ramCount++;
+  }
+
+  // Copy up to max of the oldest records to out, without removing them
+  // Undated records at the head are dropped instead (one run per call, so a
+  // long one never stalls loop()) and 0 is returned; try again for the rest
+  int peek(UploadRecord* out, int max) {
+    if (sdDepth() > 0) {
+      int n = readFile(sdRead, out, max);
+      int skip = 0;
+      while (skip < n && isUndated(sdRead + skip, out[skip])) skip++;
+      if (skip > 0) {
+        undated += skip;
+        Serial.printf("Upload spool: %d records from an earlier boot never got a UTC time - dropped\n", skip);
+        pop(skip);
+        return 0;
+      }
+      // End the batch before the next undated one, so pop() stays in step
+      for (int i = 0; i < n; i++) {
+        if (isUndated(sdRead + i, out[i])) return i;
+      }
+      return n;
+    }
+
+    int n = ramCount < max ? ramCount : max;
+    for (int i = 0; i < n; i++) out[i] = ring[(head + i) % capacity];
+    return n;
+  }
+
+  // Remove the first n records the last peek() returned
+  void pop(int n) {
+    if (n <= 0) return;
+    if (sdDepth() > 0) {
+      sdRead += n;
+      if (sdRead >= sdCount) {
+        SD.remove(SPOOL_FILE);
+        sdCount = sdRead = 0;
+      } else {
+        writeReadIndex();
+        UploadRecord next;
+        if (readFile(sdRead, &next, 1) == 1) sdHeadTime = next.time;
+      }
+      return;
+    }
+    head = (head + n) % capacity;
+    ramCount -= n;
+  }
+
+private:
+  UploadRecord* ring = nullptr;
+  int capacity = 0;
+  int head = 0;
+  int ramCount = 0;
+
+  bool sdEnabled = false;
+  uint32_t sdCount = 0;     // Records in SPOOL_FILE
+  uint32_t sdRead = 0;      // Records of it already uploaded
+  uint32_t sdHeadTime = 0;  // Time of record sdRead
+  uint32_t priorBootEnd = 0; // Records before this were spooled by an earlier boot
+
+  // An uptime from an earlier boot can never be turned into UTC: the server
+  // would have to guess its time, so it is not sent at all
+  bool isUndated(uint32_t index, const UploadRecord& record) const {
+    return index < priorBootEnd && (record.time & UPLOAD_TIME_UPTIME);
+  }
+
+  // Ring is full: move its oldest records to SD, or drop them if that is not possible
+  void makeRoom() {
+    int n = ramCount < SPOOL_FLUSH_RECORDS ? ramCount : SPOOL_FLUSH_RECORDS;
+    bool fits = (sdCount + n) * sizeof(UploadRecord) + sizeof(SpoolFileHeader) <= SPOOL_SD_MAX_BYTES;
+    if (!sdEnabled || !fits || !appendFile(n)) {
+      dropped += n;
+      Serial.printf("Upload spool full - %d oldest records dropped\n", n);
+    }
+    head = (head + n) % capacity;
+    ramCount -= n;
+  }
+
+  bool appendFile(int n) {
+    File file = SD.open(SPOOL_FILE, FILE_APPEND);
+    if (!file) return false;
+
+    bool ok = true;
+    if (file.size() == 0) {
+      SpoolFileHeader header = {SPOOL_FILE_MAGIC, SPOOL_FILE_VERSION, sizeof(UploadRecord), 0};
+      ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+      sdCount = sdRead = priorBootEnd = 0;
+    }
+    // The n records may wrap around the end of the ring
+    for (int done = 0; ok && done < n; ) {
+      int start = (head + done) % capacity;
+      int run = capacity - start < n - done ? capacity - start : n - done;
+      size_t bytes = run * sizeof(UploadRecord);
+      ok = file.write((const uint8_t*)&ring[start], bytes) == bytes;
+      done += run;
+    }
+    file.close();
+    if (!ok) return false;
+
+    if (sdDepth() == 0) sdHeadTime = ring[head].time;
+    sdCount += n;
+    return true;
+  }
+
+  int readFile(uint32_t index, UploadRecord* out, int max) {
+    uint32_t available = sdCount - index;
+    int n = available < (uint32_t)max ? (int)available : max;
+
+    File file = SD.open(SPOOL_FILE, FILE_READ);
+    if (!file) return 0;
+    file.seek(sizeof(SpoolFileHeader) + index * sizeof(UploadRecord));
+    int got = file.read((uint8_t*)out, n * sizeof(UploadRecord)) / sizeof(UploadRecord);
+    file.close();
+    return got;
+  }
+
+  void writeReadIndex() {
+    File file = SD.open(SPOOL_FILE, "r+");
+    if (!file) return;
+    file.seek(offsetof(SpoolFileHeader, readIndex));
+    file.write((const uint8_t*)&sdRead, sizeof(sdRead));
+    file.close();
+  }
+
+  void openFile() {
+    File file = SD.open(SPOOL_FILE, FILE_READ);
+    if (!file) return;
+
+    SpoolFileHeader header;
+    bool valid = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+                 header.magic == SPOOL_FILE_MAGIC &&
+                 header.version == SPOOL_FILE_VERSION &&
+                 header.recordSize == sizeof(UploadRecord);
+    uint32_t count = valid ? (file.size() - sizeof(header)) / sizeof(UploadRecord) : 0;
+    file.close();
+
+    if (!valid || header.readIndex >= count) {
+      SD.remove(SPOOL_FILE);  // Foreign, stale or fully uploaded
+      return;
+    }
+    sdCount = count;
+    sdRead = header.readIndex;
+    priorBootEnd = count;
+    UploadRecord first;
+    if (readFile(sdRead, &first, 1) == 1) sdHeadTime = first.time;
+  }
+};
+
 class CloudUploadManager {
 public:
   unsigned long lastUploadTime;
-  bool uploadInProgress;
+  volatile bool uploadInProgress;  // Set by loop() on handoff, cleared by the upload task
   ConfigManager* configMgr;
+  TelemetrySpool spool;
 
-  void begin(ConfigManager* cfg) {
+  void begin(ConfigManager* cfg, int capacity, bool useSD) {
     configMgr = cfg;
     lastUploadTime = 0;
     uploadInProgress = false;
+
+    // Big enough for a whole fleet snapshot or one replay batch
+    batchCapacity = capacity > UPLOAD_BATCH_MAX ? capacity : UPLOAD_BATCH_MAX;
+    batch = (UploadRecord*)(psramFound() ? ps_calloc(batchCapacity, sizeof(UploadRecord))
+                                         : calloc(batchCapacity, sizeof(UploadRecord)));
+    if (!batch) batchCapacity = 0;
+    spool.begin(useSD);
+
+    xTaskCreatePinnedToCore(uploadTask, "upload", UPLOAD_TASK_STACK, this,
+                            UPLOAD_TASK_PRIORITY, &taskHandle, UPLOAD_TASK_CORE);
   }
 
-  void update(TransmitterData transmitters[], int numTx, GPSData* gpsData,
+  // Snapshots the fleet every CLOUD_UPLOAD_INTERVAL whether or not WiFi is up;
+  // whatever the cloud does not take goes to the spool, which is replayed
+  // (oldest first, within the replay budget) between snapshots
+  void update(FleetTable* fleet, GPSData* gpsData,
               AlarmManager* alarmMgr, bool wifiConnected) {
 
     if (!configMgr->config.cloudEnabled) return;
-    if (!wifiConnected) return;
-    if (uploadInProgress) return;
+    if (uploadInProgress) return;  // Previous batch still on the wire
+    if (batchCount > 0) finishBatch();
+
+    unsigned long now = millis();
+    refillReplayBudget(now);
+
+    if (now - lastUploadTime >= CLOUD_UPLOAD_INTERVAL) {
+      lastUploadTime = now;
+
+      // Check if API key is configured
+      if (strlen(configMgr->config.apiKey) == 0) {
+        Serial.println("[CloudUpload] ERROR: API key not configured");
+        return;
+      }
 
-    if (millis() - lastUploadTime >= CLOUD_UPLOAD_INTERVAL) {
-      uploadData(transmitters, numTx, gpsData, alarmMgr);
-      lastUploadTime = millis();
+      capture(fleet, gpsData);
+      if (batchCount == 0) return;
+      if (!wifiConnected || !clockService.synced()) {
+        // Keep the snapshot for when coverage (or the time to stamp it with) comes back
+        for (int i = 0; i < batchCount; i++) spool.push(batch[i]);
+        batchCount = 0;
+        return;
+      }
+      startBatch(false);
+      return;
+    }
+
+    if (wifiConnected && clockService.synced() && !spool.empty() &&
+        (long)(now - nextReplayTime) >= 0) {
+      startReplay(now);
     }
   }
 
+  // Seconds the oldest spooled reading has been waiting (0 = nothing spooled)
+  uint32_t replayLag() {
+    if (spool.empty()) return 0;
+    uint32_t oldest = spool.oldestTime();
+    uint32_t now = clockService.nowSeconds();
+    if (oldest & UPLOAD_TIME_UPTIME) {
+      oldest &= ~UPLOAD_TIME_UPTIME;
+      now = millis() / 1000;
+    }
+    return now > oldest ? now - oldest : 0;  // Unknown while the clock is not synced
+  }
+
   // Extract numeric trailer ID from transmitter ID string
   // Examples: "TRAILER1" → 1, "DOLLY3" → 3, "TX001" → 1
   int extractTrailerId(const char* txID) {
@@ -1153,74 +2076,253 @@ public:
     return 0; // Unknown format
   }
 
-  void uploadData(TransmitterData transmitters[], int numTx, GPSData* gpsData,
-                  AlarmManager* alarmMgr) {
+  // Upload statistics (for /api/upload/status endpoint)
+  unsigned long uploadCount = 0;     // Readings accepted by the server
+  unsigned long replayedCount = 0;   // ...of which came from the spool
+  unsigned long rejectedCount = 0;   // Readings the server refused for good (4xx), dropped
+  unsigned long rejectedBatches = 0; // Requests that got such a refusal
+  bool lastSuccess = false;
+  int lastHttpStatus = 0;
+  int lastBatchSize = 0;             // Readings in the last upload cycle
+  unsigned long lastDurationMs = 0;  // Wall time of the last upload cycle
+
+private:
+  // Handed over by startBatch(), read by the task - loop() only touches them
+  // while uploadInProgress is false
+  UploadRecord* batch = nullptr;
+  int batchCapacity = 0;
+  int batchCount = 0;
+  bool batchIsReplay = false;
+  float warnOffset;
+  float critOffset;
+  char deviceID[32];
+  char authHeader[136];  // "Bearer " + apiKey
+  char endpoint[128];
+
+  // Results of the last batch, written by the task
+  int settledCount = 0;      // Leading records of batch[] the server took or refused for good
+  int acceptedCount = 0;     // ...of which it took
+  size_t sentBytes = 0;      // JSON bytes those took
+
+  // Replay rate limit: a token bucket of JSON bytes, refilled at the
+  // configured replayBudget per minute and capped at one minute's worth
+  long replayTokens = 0;
+  unsigned long lastRefill = 0;
+  unsigned long nextReplayTime = 0;
+  size_t bytesPerRecord = 400;  // Learned from uploads, sizes replay batches
+
+  // Owned by the upload task
+  TaskHandle_t taskHandle = nullptr;
+  WiFiClientSecure client;  // Kept open between requests when the server allows it
+  HTTPClient http;
+  String batchUrl;          // Batch endpoint after redirects, empty = resolve again
+
+  void capture(FleetTable* fleet, GPSData* gpsData) {
+    TransmitterData* transmitters = fleet->slots;
+    uint32_t seconds = clockService.synced() ? clockService.nowSeconds()
+                                             : (millis() / 1000) | UPLOAD_TIME_UPTIME;
+
+    batchCount = 0;
+    for (int n = 0; n < fleet->activeCount && batchCount < batchCapacity; n++) {
+      int i = fleet->activeList[n];
+      UploadRecord& record = batch[batchCount++];
+      record.time = seconds;
+      memset(record.txID, 0, sizeof(record.txID));
+      strncpy(record.txID, transmitters[i].txID, sizeof(record.txID) - 1);
+      for (int j = 0; j < 8; j++) record.hubCenti[j] = toCenti(transmitters[i].temps[j]);
+      record.ambientCenti = toCenti(transmitters[i].ambientTemp);
+      record.latitudeE6 = lround(gpsData->latitude * 1e6);
+      record.longitudeE6 = lround(gpsData->longitude * 1e6);
+      record.speedDeciKmh = (uint16_t)constrain(lroundf(gpsData->speedKmh * 10), 0, 65535);
+    }
+  }
+
+  static int16_t toCenti(float value) {
+    return (int16_t)constrain(lroundf(value * 100), -32768, 32767);
+  }
+
+  void startReplay(unsigned long now) {
+    if (replayTokens <= 0) return;
+    int count = replayTokens / bytesPerRecord;
+    if (count > UPLOAD_BATCH_MAX) count = UPLOAD_BATCH_MAX;
+    if (count == 0) return;
+
+    batchCount = spool.peek(batch, count);
+    if (batchCount == 0) return;
+    nextReplayTime = now + SPOOL_REPLAY_INTERVAL_MS;
+    startBatch(true);
+  }
+
+  // Copy everything else the task needs, so a config save on loop() can never
+  // change a batch half way through
+  void startBatch(bool replay) {
+    // Readings captured before the clock synced get their UTC now (it is)
+    for (int i = 0; i < batchCount; i++) {
+      if (batch[i].time & UPLOAD_TIME_UPTIME) {
+        batch[i].time = clockService.utcAtMillis((batch[i].time & ~UPLOAD_TIME_UPTIME) * 1000UL) / 1000;
+      }
+    }
+
+    batchIsReplay = replay;
+    warnOffset = configMgr->config.warnOffset;
+    critOffset = configMgr->config.critOffset;
+    strncpy(deviceID, configMgr->config.deviceID, sizeof(deviceID) - 1);
+    snprintf(authHeader, sizeof(authHeader), "Bearer %s", configMgr->config.apiKey);
+    if (strcmp(endpoint, configMgr->config.cloudEndpoint) != 0) {
+      strncpy(endpoint, configMgr->config.cloudEndpoint, sizeof(endpoint) - 1);
+      batchUrl = "";  // Endpoint changed, forget the cached redirect
+    }
 
     uploadInProgress = true;
+    xTaskNotifyGive(taskHandle);
+  }
 
-    Serial.println("[CloudUpload] Starting upload...");
+  // Account for the batch the task just finished: replayed records the server
+  // took or refused for good leave the spool, live ones it never answered go into it
+  void finishBatch() {
+    int settled = settledCount;
+    if (acceptedCount > 0) bytesPerRecord = sentBytes / acceptedCount;
 
-    // Check if API key is configured
-    if (strlen(configMgr->config.apiKey) == 0) {
-      Serial.println("[CloudUpload] ERROR: API key not configured");
-      uploadInProgress = false;
-      return;
+    if (batchIsReplay) {
+      spool.pop(settled);
+      replayedCount += acceptedCount;
+      replayTokens -= sentBytes;
+    } else {
+      for (int i = settled; i < batchCount; i++) spool.push(batch[i]);
+    }
+    if (settled < batchCount) nextReplayTime = millis() + SPOOL_RETRY_MS;
+    batchCount = 0;
+  }
+
+  // A 4xx that retrying the same chunk can never fix (malformed or refused data);
+  // auth, timeout and rate-limit answers are about the request, so those are kept
+  static bool rejectedForGood(int httpCode) {
+    return httpCode >= 400 && httpCode < 500 &&
+           httpCode != 401 && httpCode != 403 && httpCode != 408 && httpCode != 429;
+  }
+
+  void refillReplayBudget(unsigned long now) {
+    if (now - lastRefill < 1000) return;
+    long budget = configMgr->config.replayBudget;
+    replayTokens += (long)((now - lastRefill) * (uint64_t)budget / 60000);
+    if (replayTokens > budget) replayTokens = budget;
+    lastRefill = now;
+  }
+
+  static void uploadTask(void* param) {
+    CloudUploadManager* manager = (CloudUploadManager*)param;
+    manager->client.setInsecure();  // Endpoint is user-configurable, no CA is pinned
+    manager->http.setReuse(true);
+    manager->http.setTimeout(UPLOAD_TIMEOUT_MS);
+    for (;;) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      manager->uploadData();
+      manager->uploadInProgress = false;
     }
+  }
 
-    int activeTxCount = 0;
-    bool anySuccess = false;
+  // Post the batch, UPLOAD_BATCH_MAX records per request, all on one connection.
+  // Stops at the first temporary failure (connection, 5xx) so the records it did
+  // not cover stay in order; a chunk refused for good is dropped and counted
+  void uploadData() {
+    unsigned long started = millis();
+
+    Serial.printf("[CloudUpload] Starting %s upload of %d readings...\n",
+                  batchIsReplay ? "replay" : "live", batchCount);
+
+    settledCount = 0;
+    acceptedCount = 0;
+    sentBytes = 0;
+    while (settledCount < batchCount) {
+      int count = batchCount - settledCount;
+      if (count > UPLOAD_BATCH_MAX) count = UPLOAD_BATCH_MAX;
+
+      String payload;
+      buildPayload(settledCount, count, payload);
+      Serial.printf("[CloudUpload] Batch of %d: %d bytes\n", count, payload.length());
+
+      int64_t started = esp_timer_get_time();
+      int httpCode = post(payload);
+      perfRecord(PERF_UPLOAD, started);
+      lastHttpStatus = httpCode;
+      lastSuccess = (httpCode == HTTP_CODE_OK || httpCode == HTTP_CODE_CREATED);
+      if (!lastSuccess) {
+        if (!rejectedForGood(httpCode)) break;
+        // Retrying would fail the same way and hold up everything behind it
+        Serial.printf("[CloudUpload] %d readings rejected (HTTP %d) - dropped\n", count, httpCode);
+        rejectedCount += count;
+        rejectedBatches++;
+        settledCount += count;
+        continue;
+      }
 
-    // Send separate request for each active trailer (per CLOUD_SETUP spec)
-    for (int i = 0; i < MAX_TRANSMITTERS; i++) {
-      if (!transmitters[i].active) continue;
+      uploadCount += count;
+      acceptedCount += count;
+      settledCount += count;
+      sentBytes += payload.length();
+    }
 
-      activeTxCount++;
-      Serial.printf("[CloudUpload] Uploading trailer %s...\n", transmitters[i].txID);
+    lastBatchSize = batchCount;
+    lastDurationMs = millis() - started;
+    Serial.printf("[CloudUpload] Finished. %d of %d readings in %lu ms\n",
+                  acceptedCount, batchCount, lastDurationMs);
+  }
 
-      // Build JSON payload according to CLOUD_SETUP spec
-      StaticJsonDocument<1024> doc;
+  // Build the /batch body: device_id plus one reading per record, each shaped
+  // as the single-reading /api/telemetry payload (per CLOUD_SETUP spec)
+  void buildPayload(int first, int count, String& payload) {
+    DynamicJsonDocument doc(256 + count * 512);
 
-      // REQUIRED: identify which receiver sent this data
-      doc["device_id"] = configMgr->config.deviceID;
+    // REQUIRED: identify which receiver sent this data
+    doc["device_id"] = deviceID;
+    JsonArray readingsArray = doc.createNestedArray("readings");
 
-      // ISO 8601 timestamp (simplified - using millis as placeholder)
-      // In production, sync with NTP or GPS time
-      char timestamp[32];
-      unsigned long seconds = millis() / 1000;
-      snprintf(timestamp, sizeof(timestamp), "2025-01-01T%02lu:%02lu:%02luZ",
-               (seconds / 3600) % 24, (seconds / 60) % 60, seconds % 60);
-      doc["timestamp"] = timestamp;
+    for (int n = first; n < first + count; n++) {
+      const UploadRecord& record = batch[n];
+      JsonObject entry = readingsArray.createNestedObject();
 
-      // Trailer ID
-      doc["trailer_id"] = transmitters[i].txID;
+      // ISO 8601 UTC from the ClockService (undated records never get this far,
+      // see TelemetrySpool::peek); if it is missing the server uses arrival time
+      char timestamp[24];
+      ClockService::formatIso(record.time * 1000ULL, timestamp, sizeof(timestamp));
+      if (timestamp[0]) entry["timestamp"] = timestamp;
+      entry["trailer_id"] = record.txID;
 
       // Hub temperature readings (hub_1 through hub_8)
       // TX supports 9 sensors, web dashboard displays 8 hubs
-      JsonObject readings = doc.createNestedObject("readings");
-      readings["hub_1"] = transmitters[i].temps[0];
-      readings["hub_2"] = transmitters[i].temps[1];
-      readings["hub_3"] = transmitters[i].temps[2];
-      readings["hub_4"] = transmitters[i].temps[3];
-      readings["hub_5"] = transmitters[i].temps[4];
-      readings["hub_6"] = transmitters[i].temps[5];
-      readings["hub_7"] = transmitters[i].temps[6];
-      readings["hub_8"] = transmitters[i].temps[7];
-      readings["ambient_temp"] = transmitters[i].ambientTemp;
-
-      // Location data (from GPS)
-      JsonObject location = doc.createNestedObject("location");
-      location["latitude"] = gpsData->latitude;
-      location["longitude"] = gpsData->longitude;
-      location["speed"] = gpsData->speedKmh;
+      JsonObject readings = entry.createNestedObject("readings");
+      static const char* const hubKeys[8] = {
+        "hub_1", "hub_2", "hub_3", "hub_4", "hub_5", "hub_6", "hub_7", "hub_8"
+      };
+      // null for a sensor fault - the server stores it as a missing value
+      for (int j = 0; j < 8; j++) {
+        if (record.hubCenti[j] == TEMP_INVALID_CENTI) {
+          readings[hubKeys[j]] = nullptr;
+        } else {
+          readings[hubKeys[j]] = record.hubCenti[j] / 100.0;
+        }
+      }
+      bool ambientValid = record.ambientCenti != TEMP_INVALID_CENTI;
+      float ambient = ambientValid ? record.ambientCenti / 100.0 : 0;
+      if (ambientValid) {
+        readings["ambient_temp"] = ambient;
+      } else {
+        readings["ambient_temp"] = nullptr;
+      }
+
+      // Location data (from GPS, at capture time)
+      JsonObject loc = entry.createNestedObject("location");
+      loc["latitude"] = record.latitudeE6 / 1e6;
+      loc["longitude"] = record.longitudeE6 / 1e6;
+      loc["speed"] = record.speedDeciKmh / 10.0;
 
       // Alert (if any hub temperature delta exceeds threshold)
       // Compare delta (temp - ambient) to thresholds, not absolute temperature
-      float ambient = transmitters[i].ambientTemp;
       float maxDelta = 0;
       float maxTemp = 0;
       for (int j = 0; j < 8; j++) {
-        float temp = transmitters[i].temps[j];
-        if (temp > 1.0) { // Ignore unused sensors (0.0)
+        float temp = record.hubCenti[j] / 100.0;
+        if (temp > 1.0 && ambientValid) { // Ignore unused sensors (0.0) and faults
           float delta = temp - ambient;
           if (delta > maxDelta) {
             maxDelta = delta;
@@ -1229,120 +2331,91 @@ public:
         }
       }
 
-      if (maxDelta > configMgr->config.warnOffset) {
-        JsonObject alert = doc.createNestedObject("alert");
-        if (maxDelta > configMgr->config.critOffset) {
-          alert["level"] = "critical";
-        } else {
-          alert["level"] = "warning";
-        }
+      if (maxDelta > warnOffset) {
+        JsonObject alert = entry.createNestedObject("alert");
+        alert["level"] = (maxDelta > critOffset) ? "critical" : "warning";
         char msg[100];
         snprintf(msg, sizeof(msg), "High temperature detected: %.1f°C (%.1f°C above ambient)", maxTemp, maxDelta);
         alert["message"] = msg;
       }
+    }
 
-      String payload;
-      serializeJson(doc, payload);
-
-      Serial.printf("[CloudUpload] Trailer %s: RSSI=%d, Ambient=%.1f°C, MaxHub=%.1f°C\n",
-                    transmitters[i].txID, transmitters[i].rssi,
-                    transmitters[i].ambientTemp, maxTemp);
-      Serial.printf("[CloudUpload] Payload size: %d bytes\n", payload.length());
-      Serial.printf("[CloudUpload] Posting to: %s\n", configMgr->config.cloudEndpoint);
-
-      // Send HTTP POST with manual redirect handling
-      HTTPClient http;
-      http.setTimeout(10000); // 10 second timeout
-
-      String currentUrl = configMgr->config.cloudEndpoint;
-      int httpCode = -1;
-      int redirectCount = 0;
-      const int MAX_REDIRECTS = 3;
-
-      // Build Authorization header
-      String authHeader = "Bearer ";
-      authHeader += configMgr->config.apiKey;
-
-      // Manual redirect loop (HTTPClient doesn't follow POST redirects properly)
-      while (redirectCount <= MAX_REDIRECTS) {
-        http.begin(currentUrl);
-        http.addHeader("Content-Type", "application/json");
-        http.addHeader("Authorization", authHeader);
-
-        httpCode = http.POST(payload);
-
-        if (httpCode > 0) {
-          Serial.printf("[CloudUpload] HTTP Response code: %d\n", httpCode);
-
-          // Check if this is a redirect (3xx status)
-          if (httpCode >= 300 && httpCode < 400) {
-            String location = http.getLocation();
-
-            if (location.length() > 0) {
-              Serial.printf("[CloudUpload] Redirected to: %s\n", location.c_str());
-              http.end(); // Close current connection
-              currentUrl = location;
-              redirectCount++;
-              continue; // Retry with new URL
-            } else {
-              Serial.println("[CloudUpload] Redirect response but no Location header");
-              break;
-            }
-          }
+    serializeJson(doc, payload);
+  }
 
-          // Not a redirect, process the response
-          break;
-        } else {
-          Serial.printf("[CloudUpload] Connection error: %s\n", http.errorToString(httpCode).c_str());
-          break;
-        }
-      }
+  // POST to the batch endpoint. The redirect target is cached, so only the first
+  // upload after boot (or after an error) follows redirects; later ones go
+  // straight there and reuse the open TLS connection
+  int post(const String& payload) {
+    if (batchUrl.length() == 0) {
+      batchUrl = endpoint;
+      batchUrl += "/batch";
+      client.stop();
+    }
 
-      // Process final response
-      if (httpCode > 0) {
-        if (httpCode == HTTP_CODE_OK || httpCode == HTTP_CODE_CREATED) {
-          uploadCount++;
-          lastSuccess = true;
-          anySuccess = true;
-          lastHttpStatus = httpCode;
-          Serial.printf("[CloudUpload] ✓ Trailer %s uploaded successfully\n", transmitters[i].txID);
-        } else {
-          lastSuccess = false;
-          lastHttpStatus = httpCode;
-          String response = http.getString();
-          Serial.printf("[CloudUpload] ✗ Trailer %s upload failed (HTTP %d)\n",
-                        transmitters[i].txID, httpCode);
-          if (response.length() > 0 && response.length() < 500) {
-            Serial.printf("[CloudUpload] Response: %s\n", response.c_str());
-          }
-        }
-      } else {
-        lastSuccess = false;
-        lastHttpStatus = httpCode;
-      }
+    int httpCode = -1;
+    // Manual redirect loop (HTTPClient doesn't follow POST redirects properly)
+    for (int redirectCount = 0; redirectCount <= UPLOAD_MAX_REDIRECTS; redirectCount++) {
+      http.begin(client, batchUrl);
+      http.addHeader("Content-Type", "application/json");
+      http.addHeader("Authorization", authHeader);
+
+      httpCode = http.POST(payload);
+      if (httpCode < 300 || httpCode >= 400) break;
 
+      String target = http.getLocation();
       http.end();
+      if (target.length() == 0) {
+        Serial.println("[CloudUpload] Redirect response but no Location header");
+        break;
+      }
+      Serial.printf("[CloudUpload] Redirected to: %s\n", target.c_str());
+      batchUrl = target;
+      client.stop();  // The target may be another host
     }
 
-    Serial.printf("[CloudUpload] Finished. %d trailers processed. Overall success: %s\n",
-                  activeTxCount, anySuccess ? "YES" : "NO");
-    uploadInProgress = false;
-  }
+    if (httpCode <= 0) {
+      Serial.printf("[CloudUpload] Connection error: %s\n", HTTPClient::errorToString(httpCode).c_str());
+      batchUrl = "";  // Resolve again from the configured endpoint next time
+    } else if (httpCode != HTTP_CODE_OK && httpCode != HTTP_CODE_CREATED) {
+      String response = http.getString();
+      Serial.printf("[CloudUpload] ✗ Upload failed (HTTP %d)\n", httpCode);
+      if (response.length() > 0 && response.length() < 500) {
+        Serial.printf("[CloudUpload] Response: %s\n", response.c_str());
+      }
+    } else {
+      http.getString();  // Drain the body so the connection can be reused
+      Serial.printf("[CloudUpload] ✓ HTTP %d via %s\n", httpCode, batchUrl.c_str());
+    }
 
-  // Upload statistics (for /api/upload/status endpoint)
-  unsigned long uploadCount = 0;
-  bool lastSuccess = false;
-  int lastHttpStatus = 0;
+    http.end();  // Leaves the connection open when the server kept it alive
+    return httpCode;
+  }
 };
 
 // ======================== WEB SERVER METHODS (after CloudUploadManager) ========================
 void WebConfigServer::handleUploadStatus() {
-  StaticJsonDocument<256> doc;
+  StaticJsonDocument<512> doc;
   doc["enabled"] = configMgr->config.cloudEnabled;
   doc["lastUploadTime"] = cloudUpload->lastUploadTime / 1000; // Convert to seconds
   doc["lastSuccess"] = cloudUpload->lastSuccess;
   doc["lastHttpStatus"] = cloudUpload->lastHttpStatus;
   doc["uploadCount"] = cloudUpload->uploadCount;
+  doc["uploadInProgress"] = cloudUpload->uploadInProgress;
+  doc["lastBatchSize"] = cloudUpload->lastBatchSize;
+  doc["lastDurationMs"] = cloudUpload->lastDurationMs;
+
+  // Offline spool: readings waiting for the cloud, and how far behind replay is
+  doc["spoolDepth"] = cloudUpload->spool.depth();
+  doc["spoolSdDepth"] = cloudUpload->spool.sdDepth();
+  doc["spoolBytes"] = cloudUpload->spool.depth() * sizeof(UploadRecord);
+  doc["spoolDropped"] = cloudUpload->spool.dropped;
+  doc["spoolUndated"] = cloudUpload->spool.undated;
+  doc["replayLagSeconds"] = cloudUpload->replayLag();
+  doc["replayedCount"] = cloudUpload->replayedCount;
+  doc["rejectedCount"] = cloudUpload->rejectedCount;
+  doc["rejectedBatches"] = cloudUpload->rejectedBatches;
+  doc["replayBudget"] = configMgr->config.replayBudget;
 
   unsigned long secondsSince = (millis() - cloudUpload->lastUploadTime) / 1000;
   doc["secondsSinceLastUpload"] = secondsSince;
@@ -1353,82 +2426,54 @@ void WebConfigServer::handleUploadStatus() {
 }
 
 void WebConfigServer::handleLive() {
-  // Live dashboard page with real-time data display
-  String html = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-  <title>AxleWatch Live</title>
-  <meta name="viewport" content="width=device-width, initial-scale=1">
-  <meta http-equiv="refresh" content="5">
-  <style>
-    body { font-family: Arial; margin: 20px; background: #0b1220; color: #e8eefc; }
-    .container { max-width: 800px; margin: auto; }
-    h1 { color: #4cc9f0; }
-    .card { background: #141b2d; border: 1px solid #334; border-radius: 10px; padding: 20px; margin: 16px 0; }
-    .card h2 { color: #4cc9f0; margin: 0 0 16px; }
-    .grid { display: grid; grid-template-columns: repeat(auto-fit, minmax(140px, 1fr)); gap: 12px; }
-    .sensor-box { background: #1a2332; border: 2px solid #445; border-radius: 8px; padding: 16px; text-align: center; }
-    .sensor-box h3 { font-size: 14px; margin: 0 0 8px; opacity: .9; color: #4cc9f0; }
-    .sensor-box .temp { font-size: 32px; font-weight: bold; color: #7bd88f; }
-    .status-row { display: flex; justify-content: space-between; padding: 8px 0; border-bottom: 1px solid #334; }
-    .status-label { color: #888; font-size: 14px; }
-    .status-value { color: #4cc9f0; font-weight: 600; font-size: 14px; }
-    a { color: #4cc9f0; text-decoration: none; }
-  </style>
-</head>
-<body>
-  <div class="container">
-    <h1>AxleWatch Live Dashboard</h1>
-    <p><a href="/">← Back to Configuration</a></p>
-    <div class="card">
-      <h2>Active Transmitters</h2>
-      <div id="transmitters"></div>
-    </div>
-    <div class="card">
-      <h2>System Status</h2>
-      <div class="status-row">
-        <span class="status-label">Device ID:</span>
-        <span class="status-value" id="deviceId">-</span>
-      </div>
-      <div class="status-row">
-        <span class="status-label">WiFi:</span>
-        <span class="status-value" id="wifiStatus">-</span>
-      </div>
-      <div class="status-row">
-        <span class="status-label">GPS:</span>
-        <span class="status-value" id="gpsStatus">-</span>
-      </div>
-    </div>
-  </div>
-  <script>
-  fetch('/api/live').then(r=>r.json()).then(d=>{
-    document.getElementById('deviceId').textContent=d.deviceId;
-    document.getElementById('wifiStatus').textContent=d.wifiConnected?'Connected':'Disconnected';
-    document.getElementById('gpsStatus').textContent=d.gps.fix?'Fix ('+d.gps.satellites+' sats)':'No Fix';
-    let html='';
-    d.trailers.forEach(t=>{
-      html+='<h3>'+t.id+'</h3><div class="grid">';
-      t.hubTemperatures.forEach((temp,i)=>{
-        html+='<div class="sensor-box"><h3>Hub '+(i+1)+'</h3><div class="temp">'+temp.toFixed(1)+'°C</div></div>';
-      });
-      html+='</div><p>Ambient: '+t.ambientTemp.toFixed(1)+'°C | RSSI: '+t.rssi+'</p>';
-    });
-    document.getElementById('transmitters').innerHTML=html||'<p>No active transmitters</p>';
-  });
-  </script>
-</body>
-</html>
-)rawliteral";
-  webServer.send(200, "text/html", html);
+  // Live dashboard page, filled from /api/live and updated from /api/events
+  sendStaticPage(RX_LIVE_HTML_GZ, RX_LIVE_HTML_GZ_LEN, RX_LIVE_HTML_ETAG);
+}
+
+// One trailer as reported by /api/live and the `tx` event
+void fillTrailerJson(JsonObject trailer, int i) {
+  trailer["id"] = i + 1;
+  trailer["name"] = transmitters[i].txID;
+  trailer["online"] = transmitters[i].active;
+  trailer["rssi"] = transmitters[i].rssi;
+  trailer["lastUpdate"] = transmitters[i].lastReceived / 1000;
+  if (clockService.synced()) {
+    char utc[24];
+    ClockService::formatIso(clockService.utcAtMillis(transmitters[i].lastReceived), utc, sizeof(utc));
+    trailer["lastUpdateUtc"] = utc;
+  }
+  // null for a sensor the TX could not read
+  if (tempFault(transmitters[i].ambientTemp)) {
+    trailer["ambientTemp"] = nullptr;
+  } else {
+    trailer["ambientTemp"] = transmitters[i].ambientTemp;
+  }
+
+  JsonArray hubTemps = trailer.createNestedArray("hubTemperatures");
+  JsonArray hubRise = trailer.createNestedArray("hubRiseRates");  // °C/min
+  for (int j = 0; j < 8 && j < NUM_TEMP_SENSORS; j++) {
+    if (tempFault(transmitters[i].temps[j])) {
+      hubTemps.add(nullptr);
+    } else {
+      hubTemps.add(transmitters[i].temps[j]);
+    }
+    hubRise.add(fleet.alarms[i].riseRates[j]);
+  }
 }
 
 void WebConfigServer::handleApiLive() {
   // Return live data in JSON format matching cloud upload structure
-  DynamicJsonDocument doc(4096);
+  DynamicJsonDocument doc(1024 + fleet.activeCount * 512);  // ~450 B per trailer
 
   doc["deviceId"] = configMgr->config.deviceID;
-  doc["timestamp"] = millis() / 1000;
+  // UTC seconds once the clock is synced, uptime seconds until then
+  char utc[24];
+  uint64_t utcMs = clockService.nowMs();
+  ClockService::formatIso(utcMs, utc, sizeof(utc));
+  doc["timestamp"] = utcMs ? (unsigned long)(utcMs / 1000) : millis() / 1000;
+  doc["utc"] = utc;
+  doc["uptime"] = millis() / 1000;
+  doc["clockSource"] = ClockService::sourceName(clockService.source);
   doc["wifiConnected"] = (wifiState == WIFI_STATE_CONNECTED_STA);
 
   // GPS data
@@ -1444,30 +2489,196 @@ void WebConfigServer::handleApiLive() {
 
   // Trailers
   JsonArray trailersArray = doc.createNestedArray("trailers");
-  for (int i = 0; i < MAX_TRANSMITTERS; i++) {
-    if (!transmitters[i].active) continue;
-
-    JsonObject trailer = trailersArray.createNestedObject();
-    trailer["id"] = i + 1;
-    trailer["name"] = transmitters[i].txID;
-    trailer["online"] = true;
-    trailer["rssi"] = transmitters[i].rssi;
-    trailer["lastUpdate"] = transmitters[i].lastReceived / 1000;
-    trailer["ambientTemp"] = transmitters[i].ambientTemp;
+  for (int n = 0; n < fleet.activeCount; n++) {
+    fillTrailerJson(trailersArray.createNestedObject(), fleet.activeList[n]);
+  }
 
-    JsonArray hubTemps = trailer.createNestedArray("hubTemperatures");
-    for (int j = 0; j < 8 && j < NUM_TEMP_SENSORS; j++) {
-      hubTemps.add(transmitters[i].temps[j]);
+  doc["wifiRssi"] = WiFi.RSSI();
+
+  String json;
+  serializeJson(doc, json);
+  webServer.send(200, "application/json", json);
+}
+
+void WebConfigServer::handleApiLora() {
+  DynamicJsonDocument doc(2048);
+
+  unsigned long corrupted = loraManager.crcErrors + loraManager.invalidPackets;
+  doc["packetsReceived"] = loraManager.packetsReceived;
+  doc["crcErrors"] = loraManager.crcErrors;
+  doc["invalidPackets"] = loraManager.invalidPackets;
+  if (loraManager.packetsReceived > 0) {
+    doc["corruptionRate"] = (float)corrupted / loraManager.packetsReceived;
+  }
+  doc["slotLengthMs"] = SLOT_LENGTH_MS;
+  doc["queueDepth"] = loraManager.queue.depth();
+  doc["queueHighWater"] = loraManager.queue.highWater;
+  doc["queueCapacity"] = RX_QUEUE_SIZE;
+  doc["queueOverflows"] = loraManager.queue.overflows;
+
+  doc["fleetCapacity"] = fleet.capacity;
+  doc["fleetActive"] = fleet.activeCount;
+  doc["fleetRejected"] = fleet.rejected;
+
+  JsonArray txArray = doc.createNestedArray("transmitters");
+  for (int n = 0; n < fleet.activeCount; n++) {
+    int i = fleet.activeList[n];
+
+    JsonObject tx = txArray.createNestedObject();
+    tx["name"] = transmitters[i].txID;
+    if (fleet.txSlots[i] != 0xFF) tx["slot"] = fleet.txSlots[i];
+    tx["rssi"] = transmitters[i].rssi;
+    tx["frames"] = linkStats[i].frames;
+    tx["missedFrames"] = linkStats[i].missedFrames;
+    unsigned long expected = linkStats[i].frames + linkStats[i].missedFrames;
+    if (expected > 0) {
+      tx["lossRate"] = (float)linkStats[i].missedFrames / expected;
     }
   }
 
-  doc["wifiRssi"] = WiFi.RSSI();
+  String json;
+  serializeJson(doc, json);
+  webServer.send(200, "application/json", json);
+}
+
+// One /api/perf stage: count, min/avg/p50/p99/max in microseconds
+void fillPerfStageJson(JsonObject out, const PerfStage& stage) {
+  out["count"] = stage.count;
+  out["minUs"] = stage.minUs;
+  out["avgUs"] = stage.averageUs();
+  out["p50Us"] = stage.percentileUs(0.50f);
+  out["p99Us"] = stage.percentileUs(0.99f);
+  out["maxUs"] = stage.maxUs;
+}
+
+// Stage timings, radio duty cycle, display/SD work and memory, all since boot
+// (for scraping during field trials; LoRa and upload task stages are copied
+// while those tasks may be writing, see axlewatch_perf.h)
+void WebConfigServer::handleApiPerf() {
+  DynamicJsonDocument doc(3072);
+
+  static PerfStage stages[PERF_STAGE_COUNT];
+  memcpy(stages, perfStages, sizeof(stages));
+
+  int64_t uptimeUs = esp_timer_get_time();
+  doc["uptimeMs"] = (uint32_t)(uptimeUs / 1000);
+
+  JsonObject stagesObj = doc.createNestedObject("stages");
+  for (int i = 0; i < PERF_STAGE_COUNT; i++) {
+    fillPerfStageJson(stagesObj.createNestedObject(perfStageNames[i]), stages[i]);
+  }
+
+  // Share of the time since boot spent transmitting ACKs (the rest is receive)
+  if (uptimeUs > 0) {
+    doc["radioDutyCycle"] = (float)stages[PERF_ACK_AIRTIME].totalUs / uptimeUs;
+  }
+
+  JsonObject display = doc.createNestedObject("display");
+  display["lastFramePixels"] = displayManager.lastFramePixels;
+  display["lastFrameUs"] = displayManager.lastFrameUs;
+
+  JsonObject sd = doc.createNestedObject("sd");
+  sd["flushes"] = sdLogger.flushCount;
+  sd["bytesDropped"] = sdLogger.bytesDropped;
+
+  JsonObject clock = doc.createNestedObject("clock");
+  clock["source"] = ClockService::sourceName(clockService.source);
+  clock["syncs"] = clockService.syncCount;
+  clock["steps"] = clockService.stepCount;
+  clock["lastErrorMs"] = clockService.lastErrorMs;
+
+  JsonObject heap = doc.createNestedObject("heap");
+  heap["free"] = ESP.getFreeHeap();
+  heap["minFree"] = ESP.getMinFreeHeap();
+  heap["largestFreeBlock"] = ESP.getMaxAllocHeap();
+  if (ESP.getPsramSize() > 0) {
+    heap["psramFree"] = ESP.getFreePsram();
+    heap["psramMinFree"] = ESP.getMinFreePsram();
+    heap["psramLargestFreeBlock"] = ESP.getMaxAllocPsram();
+  }
 
   String json;
   serializeJson(doc, json);
   webServer.send(200, "application/json", json);
 }
 
+// Open a server-sent event stream: a `tx` event whenever a transmitter slot
+// changes (same JSON as one /api/live trailer) and a periodic `status` event.
+// The socket outlives the handler and is fed by publishEvents()
+void WebConfigServer::handleEvents() {
+  int slot = 0;
+  for (int i = 0; i < EVENT_MAX_CLIENTS; i++) {
+    if (!eventClients[i].connected()) {
+      slot = i;
+      break;
+    }
+  }
+  // With every slot in use the first client is replaced
+  eventClients[slot].stop();
+
+  WiFiClient client = webServer.client();
+  client.print("HTTP/1.1 200 OK\r\n"
+               "Content-Type: text/event-stream\r\n"
+               "Cache-Control: no-cache\r\n"
+               "Connection: keep-alive\r\n\r\n"
+               "retry: 3000\n\n");
+  eventClients[slot] = client;
+  lastEventSent = millis();
+}
+
+void WebConfigServer::publishEvents() {
+  bool anyClient = false;
+  for (int i = 0; i < EVENT_MAX_CLIENTS; i++) {
+    if (eventClients[i].connected()) anyClient = true;
+  }
+  if (!anyClient) {
+    pendingCount = 0;
+    return;
+  }
+
+  char buf[768];
+  for (int n = 0; n < pendingCount; n++) {
+    // A trailer updated twice since the last push is only sent once
+    bool repeated = false;
+    for (int m = 0; m < n; m++) {
+      if (pendingSlots[m] == pendingSlots[n]) repeated = true;
+    }
+    if (repeated) continue;
+
+    StaticJsonDocument<512> doc;
+    fillTrailerJson(doc.to<JsonObject>(), pendingSlots[n]);
+    sendEvent("tx", buf, serializeJson(doc, buf, sizeof(buf)));
+  }
+  pendingCount = 0;
+
+  if (millis() - lastEventSent >= EVENT_STATUS_INTERVAL) {
+    GPSData* gpsData = gpsManager.getData();
+    int len = snprintf(buf, sizeof(buf),
+                       "{\"wifiConnected\":%s,\"gps\":{\"fix\":%s,\"satellites\":%d}}",
+                       wifiState == WIFI_STATE_CONNECTED_STA ? "true" : "false",
+                       gpsData->validFix ? "true" : "false", gpsData->satellites);
+    sendEvent("status", buf, len);
+  }
+}
+
+// Write one event to every connected client; a client that fails the write is dropped
+void WebConfigServer::sendEvent(const char* name, const char* data, size_t len) {
+  char head[32];
+  int headLen = snprintf(head, sizeof(head), "event: %s\ndata: ", name);
+
+  for (int i = 0; i < EVENT_MAX_CLIENTS; i++) {
+    WiFiClient& client = eventClients[i];
+    if (!client.connected()) continue;
+
+    if (client.write((const uint8_t*)head, headLen) != (size_t)headLen ||
+        client.write((const uint8_t*)data, len) != len ||
+        client.write((const uint8_t*)"\n\n", 2) != 2) {
+      client.stop();
+    }
+  }
+  lastEventSent = millis();
+}
+
 void WebConfigServer::handleApiConfig() {
   // Return current configuration
   StaticJsonDocument<512> doc;
@@ -1477,6 +2688,7 @@ void WebConfigServer::handleApiConfig() {
   doc["cloudEnabled"] = configMgr->config.cloudEnabled;
   doc["warnOffset"] = configMgr->config.warnOffset;
   doc["critOffset"] = configMgr->config.critOffset;
+  doc["replayBudget"] = configMgr->config.replayBudget;
   doc["uptime"] = millis() / 1000;
 
   String json;
@@ -1511,8 +2723,12 @@ TouchInput touchInput;
 WebConfigServer webConfigServer;
 CloudUploadManager cloudUploadManager;
 
-TransmitterData transmitters[MAX_TRANSMITTERS];
-int numActiveTransmitters = 0;
+ClockService clockService;
+
+FleetTable fleet;
+TransmitterData* transmitters = nullptr;    // fleet.slots, indexed by fleet slot
+SequenceWindow* seenSequences = nullptr;    // Parallel to transmitters[]
+LinkStats* linkStats = nullptr;             // Parallel to transmitters[]
 
 // WiFi state machine (enum defined earlier before WebConfigServer class)
 WiFiState wifiState = WIFI_STATE_AP_MODE;
@@ -1578,6 +2794,17 @@ void setup() {
   // Initialize touch
   touchInput.begin();
 
+  // Allocate the fleet table (before LoRa: the LoRa task looks up ACK slots in it)
+  int fleetCapacity = psramFound() ? FLEET_CAPACITY_PSRAM : FLEET_CAPACITY_INTERNAL;
+  if (fleet.begin(fleetCapacity, fleetAllocate)) {
+    Serial.printf("Fleet table: %d transmitters (%s)\n", fleetCapacity, psramFound() ? "PSRAM" : "internal RAM");
+  } else {
+    Serial.println("ERROR: fleet table allocation failed");
+  }
+  transmitters = fleet.slots;
+  seenSequences = fleet.seen;
+  linkStats = fleet.links;
+
   // Initialize LoRa
   loraManager.begin();
 
@@ -1590,14 +2817,8 @@ void setup() {
   // Initialize SD logger
   sdLogger.begin();
 
-  // Initialize all transmitter slots
-  for (int i = 0; i < MAX_TRANSMITTERS; i++) {
-    transmitters[i].active = false;
-    transmitters[i].lastReceived = 0;
-  }
-
   // Initialize cloud upload manager
-  cloudUploadManager.begin(&configManager);
+  cloudUploadManager.begin(&configManager, fleet.capacity, sdLogger.sdAvailable);
 
   // Start AP mode (mandatory 60 seconds on boot)
   Serial.println("Starting AP mode for 60 seconds...");
@@ -1630,19 +2851,25 @@ void setup() {
 
 // ======================== LOOP ========================
 void loop() {
+  static int64_t lastLoopUs = 0;
+  int64_t loopStarted = esp_timer_get_time();
+  if (lastLoopUs) perfStages[PERF_LOOP_GAP].record((uint32_t)(loopStarted - lastLoopUs));
+  lastLoopUs = loopStarted;
+
   unsigned long now = millis();
 
   // Handle WiFi state machine
   handleWiFiStateMachine(now);
 
-  // Update GPS
+  // Update GPS, then the clock it disciplines
   gpsManager.update();
+  clockService.update(wifiState == WIFI_STATE_CONNECTED_STA);
 
   // Receive LoRa packets
   handleLoRaReception();
 
-  // Update alarms
-  alarmManager.update(transmitters, MAX_TRANSMITTERS,
+  // Alarm buzzer (levels are evaluated as frames arrive)
+  alarmManager.update(&fleet,
                      configManager.config.warnOffset,
                      configManager.config.critOffset);
   alarmManager.resetAlarm();
@@ -1652,18 +2879,21 @@ void loop() {
 
   // Update display
   bool wifiConnected = (wifiState == WIFI_STATE_CONNECTED_STA);
-  displayManager.update(transmitters, MAX_TRANSMITTERS, gpsManager.getData(),
+  displayManager.update(&fleet, gpsManager.getData(),
                        &alarmManager, wifiConnected, now);
 
-  // Cloud upload (only when WiFi connected)
-  if (apModeComplete && wifiConnected) {
-    cloudUploadManager.update(transmitters, MAX_TRANSMITTERS, gpsManager.getData(),
+  // Cloud upload (spools while WiFi is down)
+  if (apModeComplete) {
+    cloudUploadManager.update(&fleet, gpsManager.getData(),
                              &alarmManager, wifiConnected);
   }
 
   // Web server
   webConfigServer.handleClient();
 
+  // Write out buffered SD log rows that have waited long enough
+  sdLogger.update(now);
+
   // Cleanup inactive transmitters (no packet for 90 seconds)
   cleanupInactiveTransmitters(now);
 
@@ -1679,6 +2909,8 @@ void loop() {
 
     lastBlink = now;
   }
+
+  perfRecord(PERF_LOOP, loopStarted);
 }
 
 // ======================== WIFI STATE MACHINE ========================
@@ -1753,33 +2985,68 @@ void handleWiFiStateMachine(unsigned long now) {
 }
 
 // ======================== LORA RECEPTION ========================
+// Frames arrive already parsed and ACKed by the LoRa task; this applies them
 void handleLoRaReception() {
   static unsigned long loraLedOffTime = 0;
-  char packet[128];
-  int rssi;
 
-  if (loraManager.receivePacket(packet, sizeof(packet), &rssi)) {
+  while (ReceivedFrame* frame = loraManager.nextFrame()) {
+    int64_t started = esp_timer_get_time();
+    const uint8_t* packet = frame->data;
+    int len = frame->len;
+    int rssi = frame->rssi;
+
     // Brief flash on LED2 for LoRa activity (only 2 LEDs available)
     digitalWrite(LED2, HIGH);
     loraLedOffTime = millis() + 100; // Keep LED on for 100ms
 
     Serial.print("LoRa RX: ");
-    Serial.print(packet);
+    if (LoRaManager::isBinaryFrame(packet, len)) {
+      Serial.printf("binary frame, %d bytes", len);
+    } else {
+      Serial.print((const char*)packet);
+    }
     Serial.print(" (RSSI: ");
     Serial.print(rssi);
     Serial.println(")");
 
-    TransmitterData tempTx;
-    if (loraManager.parsePacket(packet, &tempTx)) {
+    if (frame->valid) {
+      // Used in place in the queue slot, copied into transmitters[] only when it is applied
+      TransmitterData& tempTx = frame->tx;
+      const FrameInfo& info = frame->info;
       tempTx.rssi = rssi;
 
+      // Binary frames are keyed by their numeric ID, legacy text by name
+      bool binary = LoRaManager::isBinaryFrame(packet, len);
+      uint32_t key = binary ? info.txNumber : FleetTable::textKey(tempTx.txID);
+
       // Find or create transmitter slot
-      int txSlot = findOrCreateTransmitter(tempTx.txID);
-      if (txSlot >= 0) {
-        transmitters[txSlot] = tempTx;
+      int txSlot = findOrCreateTransmitter(key, tempTx.txID);
+
+      // Legacy text transmitters carry no sequence
+      if (binary && txSlot >= 0) {
+        countFrame(&linkStats[txSlot], info.sequence);
+      }
+
+      if (txSlot >= 0 && info.type == FRAME_TYPE_BATCH) {
+        logBackfill(txSlot, packet, &info, &tempTx);
+      } else if (txSlot >= 0 && info.type == FRAME_TYPE_DELTA && !transmitters[txSlot].active) {
+        // Nothing to apply the changes to - wait for the next keyframe
+        Serial.print("Delta frame before first keyframe from ");
+        Serial.println(tempTx.txID);
+      } else if (txSlot >= 0) {
+        if (info.type == FRAME_TYPE_DELTA) {
+          applyDelta(&transmitters[txSlot], &tempTx, info.mask);
+        } else {
+          transmitters[txSlot] = tempTx;
+          fleet.updateActive(txSlot);
+        }
+        alarmManager.evaluate(&fleet, txSlot, true);
+
+        seenSequences[txSlot].mark(info.sequence);
+        webConfigServer.notifyTransmitter(txSlot);
 
         // Log to SD card
-        sdLogger.logData(&transmitters[txSlot], gpsManager.getData(), rssi);
+        sdLogger.logData(&transmitters[txSlot], gpsManager.getData(), rssi, millis(), clockService.nowMs());
 
         Serial.print("Updated TX slot ");
         Serial.print(txSlot);
@@ -1789,6 +3056,9 @@ void handleLoRaReception() {
     } else {
       Serial.println("Invalid packet format");
     }
+
+    loraManager.releaseFrame();
+    perfRecord(PERF_FRAME_APPLY, started);
   }
 
   // Turn off LED after flash duration (will be controlled by GPS status in main loop)
@@ -1799,41 +3069,100 @@ void handleLoRaReception() {
 }
 
 // ======================== TRANSMITTER MANAGEMENT ========================
-int findOrCreateTransmitter(const char* txID) {
-  // Find existing transmitter
-  for (int i = 0; i < MAX_TRANSMITTERS; i++) {
-    if (transmitters[i].active && strcmp(transmitters[i].txID, txID) == 0) {
-      return i;
+int findOrCreateTransmitter(uint32_t key, const char* txID) {
+  int used = fleet.used;
+  int slot = fleet.findOrCreate(key, txID);
+
+  if (slot < 0) {
+    Serial.printf("Fleet full (%d active) - ignoring %s\n", fleet.activeCount, txID);
+  } else if (!transmitters[slot].active) {
+    Serial.printf("%s transmitter in slot %d: %s\n", fleet.used != used ? "New" : "Returning", slot, txID);
+  }
+  return slot;
+}
+
+// Count a received frame and any sequence numbers skipped since the last one
+// A jump of half the sequence space or more is a TX restart, not loss
+void countFrame(LinkStats* link, uint8_t sequence) {
+  if (link->lastSequence >= 0) {
+    uint8_t gap = sequence - (uint8_t)link->lastSequence - 1;
+    if (gap < 128) {
+      link->missedFrames += gap;
     }
   }
+  link->lastSequence = sequence;
+  link->frames++;
+}
+
+// Log the stored readings of a BATCH frame with their original timestamps
+// Backfill is history only: the live slot, display and alarms are left alone
+void logBackfill(int txSlot, const uint8_t* frame, const FrameInfo* info, const TransmitterData* header) {
+  SystemConfig* cfg = &configManager.config;
+  unsigned long now = millis();
+  int logged = 0;
+
+  for (int i = 0; i < info->batchCount; i++) {
+    TransmitterData reading = *header;
+    uint8_t sequence;
+    uint16_t ageSeconds;
+    loraManager.batchReading(frame, info, i, &reading, &sequence, &ageSeconds);
 
-  // Find empty slot
-  for (int i = 0; i < MAX_TRANSMITTERS; i++) {
-    if (!transmitters[i].active) {
-      Serial.print("New transmitter in slot ");
-      Serial.print(i);
-      Serial.print(": ");
-      Serial.println(txID);
-      return i;
+    if (seenSequences[txSlot].seen(sequence)) continue;
+    seenSequences[txSlot].mark(sequence);
+
+    for (int j = 0; j < NUM_TEMP_SENSORS; j++) {
+      reading.alarmLevels[j] = alarmLevel(reading.temps[j], reading.ambientTemp,
+                                          cfg->warnOffset, cfg->critOffset);
     }
+
+    // Readings older than this boot are stamped 0 rather than wrapping around;
+    // their UTC is still exact once the clock is synced
+    unsigned long ageMs = ageSeconds * 1000UL;
+    unsigned long takenAt = (ageMs <= now) ? now - ageMs : 0;
+    uint64_t utcMs = clockService.synced() ? clockService.nowMs() - ageMs : 0;
+    sdLogger.logData(&reading, nullptr, header->rssi, takenAt, utcMs);
+    logged++;
   }
 
-  Serial.println("No free transmitter slots!");
-  return -1;
+  Serial.printf("Backfill from %s: %d of %d readings new\n", header->txID, logged, info->batchCount);
+}
+
+// Copy only the slots carried by a DELTA frame into an existing transmitter
+void applyDelta(TransmitterData* slot, const TransmitterData* delta, uint16_t mask) {
+  if (mask & 1) {
+    slot->ambientTemp = delta->ambientTemp;
+  }
+  for (int i = 0; i < NUM_TEMP_SENSORS; i++) {
+    if (mask & (1 << (i + 1))) {
+      slot->temps[i] = delta->temps[i];
+    }
+  }
+  slot->lastReceived = delta->lastReceived;
+  slot->maxSilenceMs = delta->maxSilenceMs;
+  slot->rssi = delta->rssi;
 }
 
 void cleanupInactiveTransmitters(unsigned long now) {
   const unsigned long INACTIVE_TIMEOUT = 90000; // 90 seconds (allow for slow transmit rates)
 
-  for (int i = 0; i < MAX_TRANSMITTERS; i++) {
+  // Backwards, as updateActive() moves the last entry into a removed one's place
+  for (int n = fleet.activeCount - 1; n >= 0; n--) {
+    int i = fleet.activeList[n];
+    // Change-only transmitters may legitimately stay quiet for a whole keyframe period,
+    // so allow three of their announced gaps, the same margin 90 s gives a 30 s sender
+    unsigned long timeout = max(INACTIVE_TIMEOUT, 3 * transmitters[i].maxSilenceMs);
+
     // Check if active and lastReceived is in the past (prevent unsigned underflow)
     if (transmitters[i].active &&
         transmitters[i].lastReceived <= now &&
-        (now - transmitters[i].lastReceived > INACTIVE_TIMEOUT)) {
+        (now - transmitters[i].lastReceived > timeout)) {
       Serial.print("Transmitter ");
       Serial.print(transmitters[i].txID);
       Serial.println(" timed out");
       transmitters[i].active = false;
+      fleet.updateActive(i);
+      alarmManager.clear(&fleet, i);
+      webConfigServer.notifyTransmitter(i);
     }
   }
 }
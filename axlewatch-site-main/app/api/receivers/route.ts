@@ -28,8 +28,8 @@ export async function GET(req: NextRequest) {
     const receiverMacs = await getUserReceivers(user.id);
 
     // Get latest data for each receiver
-    const receivers = receiverMacs.map(mac => {
-      const telemetry = getTelemetry(mac);
+    const receivers = await Promise.all(receiverMacs.map(async mac => {
+      const telemetry = await getTelemetry(mac);
 
       if (!telemetry || telemetry.readings.length === 0) {
         return {
@@ -103,7 +103,7 @@ export async function GET(req: NextRequest) {
         },
         createdAt: new Date().toISOString(),
       };
-    });
+    }));
 
     return Response.json({ receivers });
 
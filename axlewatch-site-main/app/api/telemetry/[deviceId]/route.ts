@@ -1,8 +1,23 @@
 import { NextRequest } from "next/server";
-import { getTelemetry, getLatestReading } from "@/lib/telemetryStore";
+import {
+  getTelemetry,
+  getTelemetryHistory,
+  pickResolution,
+  HISTORY_RESOLUTIONS,
+} from "@/lib/telemetryStore";
 
 export const runtime = "nodejs";
 
+// Default history window when only some of from/to/resolution are given
+const DEFAULT_HISTORY_MS = 24 * 60 * 60 * 1000;
+
+// Accepts epoch milliseconds or anything Date.parse understands (ISO 8601)
+function parseTime(value: string | null, fallback: number): number {
+  if (!value) return fallback;
+  const t = /^\d+$/.test(value) ? parseInt(value, 10) : Date.parse(value);
+  return isNaN(t) ? NaN : t;
+}
+
 interface RouteContext {
   params: {
     deviceId: string;
@@ -26,8 +41,53 @@ export async function GET(
     // Normalize device ID (uppercase, trim)
     const normalizedDeviceId = deviceId.toUpperCase().trim();
 
+    // History mode: ?from=&to=&resolution=&trailer= returns downsampled buckets
+    const { searchParams } = new URL(req.url);
+    if (searchParams.has("from") || searchParams.has("to") || searchParams.has("resolution")) {
+      const to = parseTime(searchParams.get("to"), Date.now());
+      const from = parseTime(searchParams.get("from"), to - DEFAULT_HISTORY_MS);
+      if (isNaN(from) || isNaN(to) || from >= to) {
+        return Response.json(
+          { error: "Invalid time range: from and to must be ISO 8601 or epoch milliseconds, from before to" },
+          { status: 400 }
+        );
+      }
+
+      let resolution = searchParams.get("resolution") || "auto";
+      if (resolution === "auto") {
+        resolution = pickResolution(from, to);
+      } else if (!(resolution in HISTORY_RESOLUTIONS)) {
+        return Response.json(
+          {
+            error: "Invalid resolution",
+            allowed: ["auto"].concat(Object.keys(HISTORY_RESOLUTIONS))
+          },
+          { status: 400 }
+        );
+      }
+
+      const history = await getTelemetryHistory(
+        normalizedDeviceId,
+        from,
+        to,
+        resolution,
+        searchParams.get("trailer")
+      );
+
+      return Response.json({
+        deviceId: normalizedDeviceId,
+        from: new Date(from).toISOString(),
+        to: new Date(to).toISOString(),
+        resolution,
+        bucketsCount: history.buckets.length,
+        truncated: history.truncated,
+        nextFrom: history.nextFrom,
+        buckets: history.buckets,
+      });
+    }
+
     // Get telemetry data for this device
-    const telemetry = getTelemetry(normalizedDeviceId);
+    const telemetry = await getTelemetry(normalizedDeviceId);
 
     if (!telemetry) {
       return Response.json(
@@ -0,0 +1,92 @@
+import { NextRequest } from "next/server";
+import { storeTelemetryBatch, type TelemetryReading } from "@/lib/telemetryStore";
+
+export const runtime = "nodejs";
+
+// Receivers upload every trailer in one request here instead of one POST each
+// to /api/telemetry. Same API key check as the single-reading endpoint.
+function validateApiKey(apiKey: string | null): boolean {
+  if (!apiKey) return false;
+  return apiKey.trim().length > 0;
+}
+
+interface TelemetryBatch {
+  device_id?: string;
+  readings: TelemetryReading[];
+}
+
+export async function POST(req: NextRequest) {
+  try {
+    const authHeader = req.headers.get("authorization");
+    const apiKey = authHeader?.replace(/^Bearer\s+/i, "").trim() || null;
+
+    if (!validateApiKey(apiKey)) {
+      return Response.json(
+        { error: "Missing or invalid API key" },
+        { status: 401 }
+      );
+    }
+
+    const batch: TelemetryBatch = await req.json();
+
+    if (!batch || !Array.isArray(batch.readings)) {
+      return Response.json(
+        { error: "Missing required field: readings (array)" },
+        { status: 400 }
+      );
+    }
+
+    const deviceId = req.headers.get("x-device-id") || batch.device_id;
+    if (!deviceId) {
+      return Response.json(
+        { error: "Missing device_id" },
+        { status: 400 }
+      );
+    }
+
+    // Store every complete reading in one insert; one bad trailer must not drop the rest.
+    // A reading without a timestamp (receiver clock never synced) is stamped with
+    // its arrival time, as readingTime() does for one the receiver got wrong
+    const receivedAt = new Date().toISOString();
+    const valid: TelemetryReading[] = [];
+    const rejected: number[] = [];
+    batch.readings.forEach((reading, index) => {
+      if (!reading || !reading.trailer_id || !reading.readings) {
+        rejected.push(index);
+        return;
+      }
+      valid.push(reading.timestamp ? reading : { ...reading, timestamp: receivedAt });
+    });
+
+    if (valid.length === 0 && rejected.length > 0) {
+      return Response.json(
+        {
+          error: "Missing required fields: trailer_id, readings",
+          rejected
+        },
+        { status: 400 }
+      );
+    }
+
+    // Readings already on the server (a replay the receiver did not see
+    // acknowledged) are skipped by the insert but still count as stored
+    await storeTelemetryBatch(deviceId, valid, apiKey!);
+
+    return Response.json(
+      {
+        success: true,
+        deviceId,
+        stored: valid.length,
+        rejected
+      },
+      { status: 200 }
+    );
+
+  } catch (error) {
+    console.error("Telemetry batch POST error:", error);
+    return Response.json(
+      { error: "Internal server error" },
+      { status: 500 }
+    );
+  }
+}
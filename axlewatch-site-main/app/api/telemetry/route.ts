@@ -62,7 +62,7 @@ export async function POST(req: NextRequest) {
     }
 
     // Store the telemetry data
-    storeTelemetry(deviceId, payload, apiKey!);
+    await storeTelemetry(deviceId, payload, apiKey!);
 
     // Return success
     return Response.json(
@@ -87,7 +87,7 @@ export async function POST(req: NextRequest) {
 export async function GET(req: NextRequest) {
   try {
     const { getAllDeviceIds } = await import("@/lib/telemetryStore");
-    const deviceIds = getAllDeviceIds();
+    const deviceIds = await getAllDeviceIds();
 
     return Response.json({
       deviceIds,
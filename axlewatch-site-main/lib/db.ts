@@ -50,6 +50,58 @@ export async function initDatabase() {
       CREATE INDEX IF NOT EXISTS idx_sessions_user_id ON sessions(user_id)
     `;
 
+    // Raw telemetry, one row per trailer reading. Range-partitioned by month on
+    // recorded_at (monthly partitions are created by lib/telemetryStore.ts as
+    // readings arrive); the default partition catches anything outside them.
+    // The primary key makes replayed readings from a receiver's spool idempotent.
+    await sql`
+      CREATE TABLE IF NOT EXISTS telemetry (
+        device_id TEXT NOT NULL,
+        trailer_id TEXT NOT NULL,
+        recorded_at TIMESTAMPTZ NOT NULL,
+        received_at TIMESTAMPTZ NOT NULL DEFAULT now(),
+        hub_1 REAL, hub_2 REAL, hub_3 REAL, hub_4 REAL,
+        hub_5 REAL, hub_6 REAL, hub_7 REAL, hub_8 REAL,
+        ambient_temp REAL,
+        latitude DOUBLE PRECISION,
+        longitude DOUBLE PRECISION,
+        speed REAL,
+        alert_level SMALLINT NOT NULL DEFAULT 0,
+        alert_message TEXT,
+        PRIMARY KEY (device_id, trailer_id, recorded_at)
+      ) PARTITION BY RANGE (recorded_at)
+    `;
+
+    await sql`
+      CREATE TABLE IF NOT EXISTS telemetry_default PARTITION OF telemetry DEFAULT
+    `;
+
+    // Latest-readings lookups scan one device newest first
+    await sql`
+      CREATE INDEX IF NOT EXISTS idx_telemetry_device_time ON telemetry(device_id, recorded_at DESC)
+    `;
+
+    // Per-minute rollup kept up to date by the insert, so history charts read
+    // at most 1440 rows per trailer per day instead of every raw reading
+    await sql`
+      CREATE TABLE IF NOT EXISTS telemetry_1m (
+        device_id TEXT NOT NULL,
+        trailer_id TEXT NOT NULL,
+        bucket TIMESTAMPTZ NOT NULL,
+        hub_1 REAL, hub_2 REAL, hub_3 REAL, hub_4 REAL,
+        hub_5 REAL, hub_6 REAL, hub_7 REAL, hub_8 REAL,
+        ambient_max REAL,
+        speed_max REAL,
+        alert_level SMALLINT NOT NULL DEFAULT 0,
+        samples INTEGER NOT NULL,
+        PRIMARY KEY (device_id, trailer_id, bucket)
+      )
+    `;
+
+    await sql`
+      CREATE INDEX IF NOT EXISTS idx_telemetry_1m_device_bucket ON telemetry_1m(device_id, bucket)
+    `;
+
     console.log('Database tables initialized successfully');
   } catch (error) {
     console.error('Failed to initialize database:', error);
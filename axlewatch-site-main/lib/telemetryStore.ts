@@ -1,5 +1,7 @@
-// In-memory telemetry store
-// In production, this should be replaced with a database (PostgreSQL, MongoDB, etc.)
+// Telemetry store with Neon Postgres persistence
+// Falls back to in-memory storage (last 100 readings per device) for local development
+
+import { sql, initDatabase } from './db';
 
 export interface TelemetryReading {
   timestamp: string;
@@ -33,47 +35,449 @@ export interface DeviceTelemetry {
   apiKey: string; // Store the API key that was used (for validation)
 }
 
-// In-memory store: deviceId -> telemetry data
-const telemetryStore = new Map<string, DeviceTelemetry>();
+// One downsampled point of a trailer's history: hub and ambient maxima over
+// the bucket, so a short spike still shows on a days-long chart
+export interface TelemetryBucket {
+  trailer_id: string;
+  time: string; // ISO start of the bucket
+  hubs: (number | null)[]; // hub_1..hub_8 max
+  ambient_max: number | null;
+  speed_max: number | null;
+  alert_level: "warning" | "critical" | null;
+  samples: number;
+}
+
+// History resolutions -> bucket width in seconds. "raw" reads the telemetry
+// table directly; everything else is served from the per-minute rollup.
+export const HISTORY_RESOLUTIONS: Record<string, number> = {
+  raw: 0,
+  "1m": 60,
+  "5m": 300,
+  "15m": 900,
+  "1h": 3600,
+  "6h": 21600,
+  "1d": 86400,
+};
+
+// Most points a single history request returns per trailer
+export const MAX_HISTORY_POINTS = 1500;
+
+// In-memory fallback: deviceId -> telemetry data
+const localTelemetry = new Map<string, DeviceTelemetry>();
 
-// Maximum readings to store per device (keep last 100)
+// Maximum readings to keep per device in memory (keep last 100)
 const MAX_READINGS_PER_DEVICE = 100;
 
-export function storeTelemetry(
+// Readings returned by getTelemetry when backed by the database
+const LATEST_READINGS_LIMIT = 100;
+
+const HUB_KEYS = ["hub_1", "hub_2", "hub_3", "hub_4", "hub_5", "hub_6", "hub_7", "hub_8"] as const;
+const ALERT_LEVELS: (TelemetryBucket["alert_level"])[] = [null, "warning", "critical"];
+
+// Receiver clocks before this are unsynced; readings further ahead than a day are bogus
+const EARLIEST_VALID_TIME = Date.UTC(2020, 0, 1);
+const MAX_CLOCK_AHEAD_MS = 24 * 60 * 60 * 1000;
+
+let dbInitialized = false;
+async function ensureDbInitialized() {
+  if (!dbInitialized && sql) {
+    await initDatabase();
+    dbInitialized = true;
+  }
+}
+
+const isDatabaseAvailable = (): boolean => {
+  return sql !== null;
+};
+
+// Monthly partitions already created (or found to exist) by this instance
+const knownPartitions = new Set<string>();
+
+function monthStart(year: number, month: number): string {
+  const d = new Date(Date.UTC(year, month, 1));
+  return d.toISOString().slice(0, 10);
+}
+
+// Create the monthly partitions the given times fall into. Partition names
+// and bounds are built from numbers only, so the DDL string is safe.
+async function ensurePartitions(times: Date[]): Promise<void> {
+  if (!sql) return;
+
+  const months = new Set<string>();
+  times.forEach(t => months.add(t.toISOString().slice(0, 7)));
+
+  const pending = Array.from(months).filter(m => !knownPartitions.has(m));
+  for (const month of pending) {
+    const year = parseInt(month.slice(0, 4), 10);
+    const index = parseInt(month.slice(5, 7), 10) - 1;
+    const name = `telemetry_y${month.slice(0, 4)}m${month.slice(5, 7)}`;
+
+    try {
+      await sql.query(
+        `CREATE TABLE IF NOT EXISTS ${name} PARTITION OF telemetry ` +
+        `FOR VALUES FROM ('${monthStart(year, index)}') TO ('${monthStart(year, index + 1)}')`
+      );
+    } catch (error) {
+      // Rows for this month already landed in telemetry_default; keep using it
+      console.warn(`Telemetry partition ${name} not created:`, error);
+    }
+    knownPartitions.add(month);
+  }
+}
+
+// When the reading was taken; falls back to arrival time if the receiver clock is off
+function readingTime(reading: TelemetryReading, receivedAt: number): Date {
+  const t = Date.parse(reading.timestamp);
+  if (isNaN(t) || t < EARLIEST_VALID_TIME || t > receivedAt + MAX_CLOCK_AHEAD_MS) {
+    return new Date(receivedAt);
+  }
+  return new Date(t);
+}
+
+function numberOrNull(value: unknown): number | null {
+  return typeof value === "number" && isFinite(value) ? value : null;
+}
+
+function alertLevelCode(reading: TelemetryReading): number {
+  const level = reading.alert?.level;
+  return level === "critical" ? 2 : level === "warning" ? 1 : 0;
+}
+
+export async function storeTelemetry(
   deviceId: string,
   reading: TelemetryReading,
   apiKey: string
-): void {
-  const existing = telemetryStore.get(deviceId);
-
-  if (existing) {
-    // Add new reading to the beginning of the array
-    existing.readings.unshift(reading);
-    // Keep only the last MAX_READINGS_PER_DEVICE readings
-    if (existing.readings.length > MAX_READINGS_PER_DEVICE) {
-      existing.readings = existing.readings.slice(0, MAX_READINGS_PER_DEVICE);
-    }
-    existing.lastUpdate = Date.now();
-  } else {
-    // Create new device entry
-    telemetryStore.set(deviceId, {
-      deviceId,
-      lastUpdate: Date.now(),
-      readings: [reading],
-      apiKey,
-    });
+): Promise<void> {
+  await storeTelemetryBatch(deviceId, [reading], apiKey);
+}
+
+// Store several readings from one receiver in a single statement. Returns the
+// number of new rows; readings already stored (spool replays) are skipped.
+export async function storeTelemetryBatch(
+  deviceId: string,
+  readings: TelemetryReading[],
+  apiKey: string
+): Promise<number> {
+  if (readings.length === 0) return 0;
+  await ensureDbInitialized();
+
+  if (!isDatabaseAvailable() || !sql) {
+    storeLocal(deviceId, readings, apiKey);
+    return readings.length;
   }
+
+  const receivedAt = Date.now();
+  const times = readings.map(r => readingTime(r, receivedAt));
+  await ensurePartitions(times);
+
+  // Column arrays for unnest(): one round trip however many trailers
+  const hub = HUB_KEYS.map(key => readings.map(r => numberOrNull(r.readings[key])));
+  const trailerIds = readings.map(r => r.trailer_id);
+  const recordedAt = times.map(t => t.toISOString());
+  const ambient = readings.map(r => numberOrNull(r.readings.ambient_temp));
+  const latitude = readings.map(r => numberOrNull(r.location?.latitude));
+  const longitude = readings.map(r => numberOrNull(r.location?.longitude));
+  const speed = readings.map(r => numberOrNull(r.location?.speed));
+  const alertLevel = readings.map(alertLevelCode);
+  const alertMessage = readings.map(r => r.alert?.message ?? null);
+
+  // Insert the raw rows, then fold only the rows actually inserted into the
+  // per-minute rollup so replayed duplicates are not counted twice
+  const result = await sql`
+    WITH input AS (
+      SELECT * FROM unnest(
+        ${trailerIds}::text[], ${recordedAt}::timestamptz[],
+        ${hub[0]}::real[], ${hub[1]}::real[], ${hub[2]}::real[], ${hub[3]}::real[],
+        ${hub[4]}::real[], ${hub[5]}::real[], ${hub[6]}::real[], ${hub[7]}::real[],
+        ${ambient}::real[], ${latitude}::double precision[], ${longitude}::double precision[],
+        ${speed}::real[], ${alertLevel}::smallint[], ${alertMessage}::text[]
+      ) AS r(trailer_id, recorded_at, hub_1, hub_2, hub_3, hub_4, hub_5, hub_6, hub_7, hub_8,
+             ambient_temp, latitude, longitude, speed, alert_level, alert_message)
+    ),
+    inserted AS (
+      INSERT INTO telemetry (device_id, trailer_id, recorded_at,
+                             hub_1, hub_2, hub_3, hub_4, hub_5, hub_6, hub_7, hub_8,
+                             ambient_temp, latitude, longitude, speed, alert_level, alert_message)
+      SELECT ${deviceId}::text, trailer_id, recorded_at,
+             hub_1, hub_2, hub_3, hub_4, hub_5, hub_6, hub_7, hub_8,
+             ambient_temp, latitude, longitude, speed, alert_level, alert_message
+      FROM input
+      ON CONFLICT DO NOTHING
+      RETURNING trailer_id, recorded_at, hub_1, hub_2, hub_3, hub_4, hub_5, hub_6, hub_7, hub_8,
+                ambient_temp, speed, alert_level
+    ),
+    rolled AS (
+      INSERT INTO telemetry_1m (device_id, trailer_id, bucket,
+                                hub_1, hub_2, hub_3, hub_4, hub_5, hub_6, hub_7, hub_8,
+                                ambient_max, speed_max, alert_level, samples)
+      SELECT ${deviceId}::text, trailer_id, date_trunc('minute', recorded_at),
+             max(hub_1), max(hub_2), max(hub_3), max(hub_4),
+             max(hub_5), max(hub_6), max(hub_7), max(hub_8),
+             max(ambient_temp), max(speed), max(alert_level), count(*)
+      FROM inserted
+      GROUP BY trailer_id, date_trunc('minute', recorded_at)
+      ON CONFLICT (device_id, trailer_id, bucket) DO UPDATE SET
+        hub_1 = GREATEST(telemetry_1m.hub_1, EXCLUDED.hub_1),
+        hub_2 = GREATEST(telemetry_1m.hub_2, EXCLUDED.hub_2),
+        hub_3 = GREATEST(telemetry_1m.hub_3, EXCLUDED.hub_3),
+        hub_4 = GREATEST(telemetry_1m.hub_4, EXCLUDED.hub_4),
+        hub_5 = GREATEST(telemetry_1m.hub_5, EXCLUDED.hub_5),
+        hub_6 = GREATEST(telemetry_1m.hub_6, EXCLUDED.hub_6),
+        hub_7 = GREATEST(telemetry_1m.hub_7, EXCLUDED.hub_7),
+        hub_8 = GREATEST(telemetry_1m.hub_8, EXCLUDED.hub_8),
+        ambient_max = GREATEST(telemetry_1m.ambient_max, EXCLUDED.ambient_max),
+        speed_max = GREATEST(telemetry_1m.speed_max, EXCLUDED.speed_max),
+        alert_level = GREATEST(telemetry_1m.alert_level, EXCLUDED.alert_level),
+        samples = telemetry_1m.samples + EXCLUDED.samples
+    )
+    SELECT count(*)::int AS stored FROM inserted
+  `;
+
+  return result.length > 0 ? (result[0].stored as number) : 0;
 }
 
-export function getTelemetry(deviceId: string): DeviceTelemetry | null {
-  return telemetryStore.get(deviceId) || null;
+function storeLocal(deviceId: string, readings: TelemetryReading[], apiKey: string): void {
+  let existing = localTelemetry.get(deviceId);
+  if (!existing) {
+    existing = { deviceId, lastUpdate: Date.now(), readings: [], apiKey };
+    localTelemetry.set(deviceId, existing);
+  }
+
+  // Newest first, keep only the last MAX_READINGS_PER_DEVICE readings
+  existing.readings = readings.slice().reverse().concat(existing.readings);
+  if (existing.readings.length > MAX_READINGS_PER_DEVICE) {
+    existing.readings.length = MAX_READINGS_PER_DEVICE;
+  }
+  existing.lastUpdate = Date.now();
 }
 
-export function getAllDeviceIds(): string[] {
-  return Array.from(telemetryStore.keys());
+function rowToReading(row: any): TelemetryReading {
+  const reading: TelemetryReading = {
+    timestamp: new Date(row.recorded_at).toISOString(),
+    trailer_id: row.trailer_id,
+    readings: {
+      hub_1: row.hub_1 ?? 0,
+      hub_2: row.hub_2 ?? 0,
+      hub_3: row.hub_3 ?? 0,
+      hub_4: row.hub_4 ?? 0,
+      hub_5: row.hub_5 ?? 0,
+      hub_6: row.hub_6 ?? 0,
+      hub_7: row.hub_7 ?? undefined,
+      hub_8: row.hub_8 ?? undefined,
+      ambient_temp: row.ambient_temp ?? undefined,
+    },
+    location: {
+      latitude: row.latitude,
+      longitude: row.longitude,
+      speed: row.speed,
+    },
+  };
+  const level = ALERT_LEVELS[row.alert_level];
+  if (level) {
+    reading.alert = { level, message: row.alert_message || "" };
+  }
+  return reading;
 }
 
-export function getLatestReading(deviceId: string): TelemetryReading | null {
-  const telemetry = telemetryStore.get(deviceId);
+export async function getTelemetry(deviceId: string): Promise<DeviceTelemetry | null> {
+  await ensureDbInitialized();
+
+  if (!isDatabaseAvailable() || !sql) {
+    return localTelemetry.get(deviceId) || null;
+  }
+
+  const rows = await sql`
+    SELECT trailer_id, recorded_at, received_at,
+           hub_1, hub_2, hub_3, hub_4, hub_5, hub_6, hub_7, hub_8,
+           ambient_temp, latitude, longitude, speed, alert_level, alert_message
+    FROM telemetry
+    WHERE device_id = ${deviceId}
+    ORDER BY recorded_at DESC
+    LIMIT ${LATEST_READINGS_LIMIT}
+  `;
+  if (rows.length === 0) {
+    return null;
+  }
+
+  let lastUpdate = 0;
+  rows.forEach(row => {
+    lastUpdate = Math.max(lastUpdate, new Date(row.received_at).getTime());
+  });
+
+  return {
+    deviceId,
+    lastUpdate,
+    readings: rows.map(rowToReading),
+    apiKey: "",
+  };
+}
+
+export async function getAllDeviceIds(): Promise<string[]> {
+  await ensureDbInitialized();
+
+  if (!isDatabaseAvailable() || !sql) {
+    return Array.from(localTelemetry.keys());
+  }
+
+  const rows = await sql`SELECT DISTINCT device_id FROM telemetry_1m ORDER BY device_id`;
+  return rows.map(row => row.device_id as string);
+}
+
+export async function getLatestReading(deviceId: string): Promise<TelemetryReading | null> {
+  const telemetry = await getTelemetry(deviceId);
   return telemetry?.readings[0] || null;
 }
+
+// Finest resolution that keeps the range within MAX_HISTORY_POINTS per trailer
+export function pickResolution(fromMs: number, toMs: number): string {
+  const seconds = Math.max(0, toMs - fromMs) / 1000;
+  const names = Object.keys(HISTORY_RESOLUTIONS).filter(name => HISTORY_RESOLUTIONS[name] > 0);
+  for (const name of names) {
+    if (seconds / HISTORY_RESOLUTIONS[name] <= MAX_HISTORY_POINTS) {
+      return name;
+    }
+  }
+  return names[names.length - 1];
+}
+
+function rowToBucket(row: any): TelemetryBucket {
+  return {
+    trailer_id: row.trailer_id,
+    time: new Date(row.time).toISOString(),
+    hubs: HUB_KEYS.map(key => row[key] ?? null),
+    ambient_max: row.ambient_max ?? null,
+    speed_max: row.speed_max ?? null,
+    alert_level: ALERT_LEVELS[row.alert_level] ?? null,
+    samples: row.samples,
+  };
+}
+
+// One page of history. Raw readings stop at MAX_HISTORY_POINTS; when more are
+// left, truncated is set and nextFrom is the `from` that fetches the next page
+export interface TelemetryHistory {
+  buckets: TelemetryBucket[];
+  truncated: boolean;
+  nextFrom: string | null;
+}
+
+// Cut raw readings (oldest first, up to MAX_HISTORY_POINTS + 1) to one page.
+// The page ends before the first reading left out and every other one at the
+// same instant, so paging from nextFrom neither repeats nor skips a row
+function rawPage(buckets: TelemetryBucket[]): TelemetryHistory {
+  if (buckets.length <= MAX_HISTORY_POINTS) {
+    return { buckets, truncated: false, nextFrom: null };
+  }
+  const nextFrom = buckets[MAX_HISTORY_POINTS].time;
+  const page = buckets.slice(0, MAX_HISTORY_POINTS).filter(b => b.time < nextFrom);
+  if (page.length === 0) {
+    // More than a page at one instant: move on past it rather than loop forever
+    const after = new Date(Date.parse(nextFrom) + 1).toISOString();
+    return { buckets: buckets.slice(0, MAX_HISTORY_POINTS), truncated: true, nextFrom: after };
+  }
+  return { buckets: page, truncated: true, nextFrom };
+}
+
+// Downsampled history for charting, oldest first, grouped by trailer within each bucket
+export async function getTelemetryHistory(
+  deviceId: string,
+  fromMs: number,
+  toMs: number,
+  resolution: string,
+  trailerId: string | null = null
+): Promise<TelemetryHistory> {
+  const seconds = HISTORY_RESOLUTIONS[resolution];
+  await ensureDbInitialized();
+
+  if (!isDatabaseAvailable() || !sql) {
+    const buckets = localHistory(deviceId, fromMs, toMs, seconds, trailerId);
+    return seconds === 0 ? rawPage(buckets) : { buckets, truncated: false, nextFrom: null };
+  }
+
+  const from = new Date(fromMs).toISOString();
+  const to = new Date(toMs).toISOString();
+
+  if (seconds === 0) {
+    const rows = await sql`
+      SELECT trailer_id, recorded_at AS time,
+             hub_1, hub_2, hub_3, hub_4, hub_5, hub_6, hub_7, hub_8,
+             ambient_temp AS ambient_max, speed AS speed_max, alert_level, 1 AS samples
+      FROM telemetry
+      WHERE device_id = ${deviceId}
+        AND recorded_at >= ${from} AND recorded_at < ${to}
+        AND (${trailerId}::text IS NULL OR trailer_id = ${trailerId})
+      ORDER BY recorded_at, trailer_id
+      LIMIT ${MAX_HISTORY_POINTS + 1}
+    `;
+    return rawPage(rows.map(rowToBucket));
+  }
+
+  const rows = await sql`
+    SELECT trailer_id,
+           to_timestamp(floor(extract(epoch FROM bucket) / ${seconds}) * ${seconds}) AS time,
+           max(hub_1) AS hub_1, max(hub_2) AS hub_2, max(hub_3) AS hub_3, max(hub_4) AS hub_4,
+           max(hub_5) AS hub_5, max(hub_6) AS hub_6, max(hub_7) AS hub_7, max(hub_8) AS hub_8,
+           max(ambient_max) AS ambient_max, max(speed_max) AS speed_max,
+           max(alert_level) AS alert_level, sum(samples)::int AS samples
+    FROM telemetry_1m
+    WHERE device_id = ${deviceId}
+      AND bucket >= ${from} AND bucket < ${to}
+      AND (${trailerId}::text IS NULL OR trailer_id = ${trailerId})
+    GROUP BY 1, 2
+    ORDER BY 2, 1
+  `;
+  return { buckets: rows.map(rowToBucket), truncated: false, nextFrom: null };
+}
+
+// Same bucketing over the in-memory readings, so development matches production
+function localHistory(
+  deviceId: string,
+  fromMs: number,
+  toMs: number,
+  seconds: number,
+  trailerId: string | null
+): TelemetryBucket[] {
+  const telemetry = localTelemetry.get(deviceId);
+  if (!telemetry) return [];
+
+  const buckets = new Map<string, TelemetryBucket>();
+  const widthMs = Math.max(seconds, 1) * 1000;
+  const maxOf = (a: number | null, b: number | null) => (a === null ? b : b === null ? a : Math.max(a, b));
+
+  telemetry.readings.slice().reverse().forEach(reading => {
+    const t = readingTime(reading, telemetry.lastUpdate).getTime();
+    if (t < fromMs || t >= toMs) return;
+    if (trailerId !== null && reading.trailer_id !== trailerId) return;
+
+    const start = seconds === 0 ? t : Math.floor(t / widthMs) * widthMs;
+    const key = `${start}|${reading.trailer_id}`;
+    const hubs = HUB_KEYS.map(k => numberOrNull(reading.readings[k]));
+    const ambient = numberOrNull(reading.readings.ambient_temp);
+    const speed = numberOrNull(reading.location?.speed);
+    const level = ALERT_LEVELS[alertLevelCode(reading)];
+
+    const bucket = buckets.get(key);
+    if (!bucket) {
+      buckets.set(key, {
+        trailer_id: reading.trailer_id,
+        time: new Date(start).toISOString(),
+        hubs,
+        ambient_max: ambient,
+        speed_max: speed,
+        alert_level: level,
+        samples: 1,
+      });
+      return;
+    }
+    bucket.hubs = bucket.hubs.map((h, i) => maxOf(h, hubs[i]));
+    bucket.ambient_max = maxOf(bucket.ambient_max, ambient);
+    bucket.speed_max = maxOf(bucket.speed_max, speed);
+    if (ALERT_LEVELS.indexOf(level) > ALERT_LEVELS.indexOf(bucket.alert_level)) {
+      bucket.alert_level = level;
+    }
+    bucket.samples++;
+  });
+
+  return Array.from(buckets.values()).sort((a, b) =>
+    a.time === b.time ? a.trailer_id.localeCompare(b.trailer_id) : a.time < b.time ? -1 : 1
+  );
+}
@@ -0,0 +1,394 @@
+/**
+ * AxleWatch receiver fleet state
+ *
+ * Per-transmitter records, the fleet table that holds them and the hub alarm
+ * rules applied to each reading. Plain C++ like axlewatch_frame.h, so the same
+ * code also builds on a desktop (see tools/fleet_sim.cpp --selftest).
+ */
+
+#ifndef AXLEWATCH_FLEET_H
+#define AXLEWATCH_FLEET_H
+
+#include <atomic>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "axlewatch_frame.h"
+
+#define NUM_TEMP_SENSORS    9
+
+// What FRAME_CENTI_INVALID decodes to - below anything a DS18B20 reports, so
+// it is never mistaken for a reading; logged and spooled as TEMP_INVALID_CENTI
+#define TEMP_INVALID_C      -127.0f
+#define TEMP_INVALID_CENTI  -12700
+
+inline bool tempFault(float temp) { return temp <= TEMP_INVALID_C; }
+
+// Alarm evaluation (AlarmManager::evaluate, once per received frame)
+#define ALARM_HYSTERESIS_C      2.0    // A hub leaves WARN/CRIT only this far below the threshold
+#define RISE_WINDOW_MS          120000 // Rate of rise measured over the last 2 minutes...
+#define RISE_MIN_SPAN_MS        30000  // ...once at least 30 s of it is covered
+#define RISE_SAMPLES            8      // Readings kept per transmitter for the rise window
+#define RISE_WARN_C_PER_MIN     1.5    // Hub heating this fast warns at any temperature -
+#define RISE_CRIT_C_PER_MIN     3.0    // the early sign of a failing bearing
+
+struct TransmitterData {
+  char txID[16];
+  float temps[NUM_TEMP_SENSORS];
+  float ambientTemp;
+  unsigned long lastReceived;
+  unsigned long maxSilenceMs;  // Longest gap the TX announced between frames (0 = unknown)
+  int rssi;
+  bool active;
+  uint8_t alarmLevels[NUM_TEMP_SENSORS]; // 0=OK, 1=WARN, 2=CRIT
+};
+
+// Reading sequences recently seen from one transmitter, so backfilled
+// readings already logged live are not logged twice
+struct SequenceWindow {
+  uint32_t bits[8];
+
+  void clear() { memset(bits, 0, sizeof(bits)); }
+  bool seen(uint8_t seq) const { return bits[seq >> 5] & (1UL << (seq & 31)); }
+  void mark(uint8_t seq) {
+    bits[seq >> 5] |= 1UL << (seq & 31);
+    // Forget the opposite half of the sequence space so wrapped numbers read as new
+    uint8_t stale = seq + 128;
+    bits[stale >> 5] &= ~(1UL << (stale & 31));
+  }
+};
+
+// Per-transmitter alarm memory, parallel to transmitters[] (hub levels for
+// hysteresis, and recent readings for the rate-of-rise window)
+struct AlarmState {
+  bool counted;                      // Included in AlarmManager's fleet level counts
+  uint8_t level;                     // Highest hub level as counted
+  uint8_t hubLevels[NUM_TEMP_SENSORS];
+  float riseRates[NUM_TEMP_SENSORS]; // °C/min over the window (0 until it spans RISE_MIN_SPAN_MS)
+  uint8_t head;                      // Next sample slot
+  uint8_t count;
+  unsigned long sampleTimes[RISE_SAMPLES];
+  int16_t sampleCenti[RISE_SAMPLES][NUM_TEMP_SENSORS];
+};
+
+// Per-transmitter link accounting, parallel to transmitters[]
+struct LinkStats {
+  int16_t lastSequence;              // Last frame sequence seen (-1 = none yet)
+  unsigned long frames;
+  unsigned long missedFrames;        // Sequence gaps: lost to collisions or range
+};
+
+/**
+ * Store one decoded temperature in a transmitter record (slot 0 = ambient)
+ * Every decoded value lands here, binary or text
+ */
+inline void storeValue(TransmitterData* tx, int slot, int16_t centi) {
+  float value = (centi == FRAME_CENTI_INVALID) ? TEMP_INVALID_C : centi / 100.0f;
+  if (slot == 0) {
+    tx->ambientTemp = value;
+  } else {
+    tx->temps[slot - 1] = value;
+  }
+}
+
+/**
+ * Alarm level of one sensor reading: 0=OK, 1=WARN, 2=CRIT
+ * A hub already at `previous` stays there until ALARM_HYSTERESIS_C below its threshold
+ */
+inline uint8_t alarmLevel(float temp, float ambient, float warnOffset, float critOffset,
+                          uint8_t previous = 0) {
+  if (tempFault(temp) || tempFault(ambient)) return previous; // No reading - hold the level
+  if (temp < 1.0) return 0; // Ignore 0.0 (unused sensors)
+
+  float delta = temp - ambient;
+  float critAt = (previous >= 2) ? critOffset - ALARM_HYSTERESIS_C : critOffset;
+  float warnAt = (previous >= 1) ? warnOffset - ALARM_HYSTERESIS_C : warnOffset;
+  if (delta >= critAt) return 2;
+  if (delta >= warnAt) return 1;
+  return 0;
+}
+
+/**
+ * Record the transmitter's reading and recompute each hub's rise over the window
+ */
+inline void alarmAddRiseSample(AlarmState* state, const TransmitterData* tx) {
+  unsigned long now = tx->lastReceived;
+  state->sampleTimes[state->head] = now;
+  for (int j = 0; j < NUM_TEMP_SENSORS; j++) {
+    state->sampleCenti[state->head][j] = (int16_t)lroundf(tx->temps[j] * 100);
+  }
+  int newest = state->head;
+  state->head = (state->head + 1) % RISE_SAMPLES;
+  if (state->count < RISE_SAMPLES) state->count++;
+
+  // Oldest sample still inside the window
+  int oldest = -1;
+  for (int k = 1; k < state->count; k++) {
+    int idx = (newest - k + RISE_SAMPLES) % RISE_SAMPLES;
+    if (now - state->sampleTimes[idx] > RISE_WINDOW_MS) break;
+    oldest = idx;
+  }
+
+  unsigned long span = (oldest >= 0) ? now - state->sampleTimes[oldest] : 0;
+  // Only between two real readings - a sensor fault or an unused slot has no rise
+  for (int j = 0; j < NUM_TEMP_SENSORS; j++) {
+    bool measured = span >= RISE_MIN_SPAN_MS &&
+                    state->sampleCenti[newest][j] >= 100 && state->sampleCenti[oldest][j] >= 100;
+    state->riseRates[j] = measured
+        ? (state->sampleCenti[newest][j] - state->sampleCenti[oldest][j]) / 100.0f * 60000.0f / span
+        : 0;
+  }
+}
+
+/**
+ * Set every hub's level from its temperature (with hysteresis) and rate of rise,
+ * in both state->hubLevels and tx->alarmLevels; returns the highest
+ */
+inline uint8_t alarmEvaluateHubs(TransmitterData* tx, AlarmState* state,
+                                 float warnOffset, float critOffset) {
+  uint8_t maxLevel = 0;
+  for (int j = 0; j < NUM_TEMP_SENSORS; j++) {
+    uint8_t level = alarmLevel(tx->temps[j], tx->ambientTemp, warnOffset, critOffset,
+                               state->hubLevels[j]);
+    if (tx->temps[j] >= 1.0) {
+      if (state->riseRates[j] >= RISE_CRIT_C_PER_MIN) {
+        level = 2;
+      } else if (state->riseRates[j] >= RISE_WARN_C_PER_MIN && level < 1) {
+        level = 1;
+      }
+    }
+    state->hubLevels[j] = level;
+    tx->alarmLevels[j] = level;
+    if (maxLevel < level) maxLevel = level;
+  }
+  return maxLevel;
+}
+
+// Every transmitter heard, keyed by numeric ID (binary frames) or a hash of the
+// name (legacy text). Lookup is an open-addressed hash; per-loop work walks
+// activeList, so it scales with trailers in range rather than capacity.
+// A slot keeps its ID while inactive, so a returning transmitter gets its slot
+// (and sequence history) back; only a full table recycles the stalest one.
+// Only loop() changes the table; the LoRa task may find() concurrently (ACK slots).
+// Active binary transmitters also hold one of the SLOT_COUNT transmit slots;
+// any beyond that get none (0xFF) and stay on jittered timing until one frees.
+class FleetTable {
+public:
+  TransmitterData* slots = nullptr;
+  SequenceWindow* seen = nullptr;     // Parallel to slots
+  LinkStats* links = nullptr;         // Parallel to slots
+  AlarmState* alarms = nullptr;       // Parallel to slots
+  uint8_t* txSlots = nullptr;         // Parallel to slots: transmit slot, 0xFF = none
+  int capacity = 0;
+  int used = 0;                       // Slots handed out so far
+  uint16_t* activeList = nullptr;     // Active slots, in no particular order
+  int activeCount = 0;
+  unsigned long rejected = 0;         // Frames from a new transmitter with every slot active
+
+  static const uint32_t KEY_EMPTY = 0xFFFFFFFF;
+  static const uint32_t KEY_DELETED = 0xFFFFFFFE;
+
+  // Allocate room for `slotCount` transmitters with `allocate` (calloc-style, so
+  // RX can place the table in PSRAM); false if any allocation fails
+  bool begin(int slotCount, void* (*allocate)(size_t count, size_t size)) {
+    capacity = slotCount;
+    hashBits = 1;
+    while ((1 << hashBits) < 2 * capacity) hashBits++;  // Load factor <= 0.5
+    int hashSize = 1 << hashBits;
+
+    slots = (TransmitterData*)allocate(capacity, sizeof(TransmitterData));
+    seen = (SequenceWindow*)allocate(capacity, sizeof(SequenceWindow));
+    links = (LinkStats*)allocate(capacity, sizeof(LinkStats));
+    alarms = (AlarmState*)allocate(capacity, sizeof(AlarmState));
+    txSlots = (uint8_t*)allocate(capacity, sizeof(uint8_t));
+    slotKeys = (uint32_t*)allocate(capacity, sizeof(uint32_t));
+    activeList = (uint16_t*)allocate(capacity, sizeof(uint16_t));
+    activePos = (int16_t*)allocate(capacity, sizeof(int16_t));
+    for (HashTable& table : tables) {
+      table.keys = (std::atomic<uint32_t>*)allocate(hashSize, sizeof(std::atomic<uint32_t>));
+      table.slots = (std::atomic<int16_t>*)allocate(hashSize, sizeof(std::atomic<int16_t>));
+    }
+    if (!slots || !seen || !links || !alarms || !txSlots || !slotKeys || !activeList ||
+        !activePos || !tables[0].keys || !tables[0].slots || !tables[1].keys || !tables[1].slots) {
+      capacity = 0;
+      return false;
+    }
+
+    for (int i = 0; i < hashSize; i++) tables[0].keys[i].store(KEY_EMPTY, std::memory_order_relaxed);
+    hash.store(&tables[0], std::memory_order_release);
+    for (int i = 0; i < capacity; i++) {
+      activePos[i] = -1;
+      txSlots[i] = 0xFF;
+    }
+    return true;
+  }
+
+  // Key for a legacy text ID (FNV-1a), kept clear of the numeric ID range
+  static uint32_t textKey(const char* txID) {
+    uint32_t hash = 2166136261u;
+    for (const char* c = txID; *c; c++) {
+      hash = (hash ^ (uint8_t)*c) * 16777619u;
+    }
+    hash |= 0x80000000;
+    return (hash >= KEY_DELETED) ? hash - 2 : hash;
+  }
+
+  // Slot holding `key`, or -1
+  // Safe to call from the LoRa task: each entry's key is stored (release) after
+  // its slot, and a rebuild fills the spare table before swapping it in whole
+  int find(uint32_t key) const {
+    const HashTable* table = hash.load(std::memory_order_acquire);
+    if (!table) return -1;
+    uint32_t mask = (1 << hashBits) - 1;
+    for (uint32_t pos = bucket(key);; pos = (pos + 1) & mask) {
+      uint32_t k = table->keys[pos].load(std::memory_order_acquire);
+      if (k == KEY_EMPTY) return -1;
+      if (k == key) return table->slots[pos].load(std::memory_order_relaxed);
+    }
+  }
+
+  // Slot for `key`, assigning one (named txID) if it is new; -1 if every slot is active
+  int findOrCreate(uint32_t key, const char* txID) {
+    int slot = find(key);
+    if (slot >= 0) return slot;
+
+    if (used < capacity) {
+      slot = used++;
+    } else {
+      // Recycle the transmitter heard least recently (new arrivals with a full table only)
+      for (int i = 0; i < capacity; i++) {
+        if (activePos[i] < 0 && (slot < 0 || slots[i].lastReceived < slots[slot].lastReceived)) {
+          slot = i;
+        }
+      }
+      if (slot < 0) {
+        rejected++;
+        return -1;
+      }
+      remove(slotKeys[slot]);
+    }
+
+    memset(&slots[slot], 0, sizeof(TransmitterData));
+    memset(&alarms[slot], 0, sizeof(AlarmState));  // Inactive, so no longer counted
+    strncpy(slots[slot].txID, txID, sizeof(slots[slot].txID) - 1);
+    seen[slot].clear();
+    links[slot] = {-1, 0, 0};
+    slotKeys[slot] = key;
+    insert(key, slot);
+    return slot;
+  }
+
+  // Keep activeList and the transmit slots in step with slots[slot].active
+  void updateActive(int slot) {
+    bool active = slots[slot].active;
+    if (active && activePos[slot] < 0) {
+      activePos[slot] = activeCount;
+      activeList[activeCount++] = slot;
+      assignTxSlot(slot);
+    } else if (!active && activePos[slot] >= 0) {
+      // Swap-remove: move the last entry into the hole
+      int pos = activePos[slot];
+      int last = activeList[--activeCount];
+      activeList[pos] = last;
+      activePos[last] = pos;
+      activePos[slot] = -1;
+      releaseTxSlot(slot);
+    }
+  }
+
+  // Position of a slot in activeList, -1 if inactive
+  int activeIndex(int slot) const { return activePos[slot]; }
+
+private:
+  uint32_t* slotKeys = nullptr;        // Key each slot was assigned under
+  int16_t* activePos = nullptr;
+  // Two hash tables: find() reads the live one, a rebuild refills the other and
+  // swaps it in. The old one is only reused a whole rebuild later, long after
+  // any lookup still walking it has finished
+  struct HashTable {
+    std::atomic<uint32_t>* keys;
+    std::atomic<int16_t>* slots;
+  };
+  HashTable tables[2] = {};
+  std::atomic<HashTable*> hash{nullptr};
+  int hashBits = 0;
+  int deleted = 0;
+  uint16_t txSlotsTaken = 0;           // Bit N set = transmit slot N held
+
+  // Lowest free transmit slot for a binary transmitter (legacy text ones never hear an ACK)
+  void assignTxSlot(int slot) {
+    if (txSlots[slot] != 0xFF || (slotKeys[slot] & 0x80000000)) return;
+    for (uint8_t n = 0; n < SLOT_COUNT; n++) {
+      if (!(txSlotsTaken & (1 << n))) {
+        txSlotsTaken |= 1 << n;
+        txSlots[slot] = n;
+        return;
+      }
+    }
+  }
+
+  // Free a transmit slot and pass it to an active transmitter still without one
+  void releaseTxSlot(int slot) {
+    if (txSlots[slot] == 0xFF) return;
+    txSlotsTaken &= ~(1 << txSlots[slot]);
+    txSlots[slot] = 0xFF;
+    for (int n = 0; n < activeCount; n++) {
+      if (txSlots[activeList[n]] == 0xFF && !(slotKeys[activeList[n]] & 0x80000000)) {
+        assignTxSlot(activeList[n]);
+        return;
+      }
+    }
+  }
+
+  uint32_t bucket(uint32_t key) const {
+    return (key * 2654435761u) >> (32 - hashBits);  // Fibonacci hashing
+  }
+
+  // Only loop() writes, so its own reads of the keys need no ordering
+  static uint32_t keyAt(const HashTable* table, uint32_t pos) {
+    return table->keys[pos].load(std::memory_order_relaxed);
+  }
+
+  void insert(uint32_t key, int slot) {
+    insert(hash.load(std::memory_order_relaxed), key, slot);
+  }
+
+  void insert(HashTable* table, uint32_t key, int slot) {
+    uint32_t mask = (1 << hashBits) - 1;
+    uint32_t pos = bucket(key);
+    while (keyAt(table, pos) != KEY_EMPTY && keyAt(table, pos) != KEY_DELETED) {
+      pos = (pos + 1) & mask;
+    }
+    if (keyAt(table, pos) == KEY_DELETED) deleted--;
+    table->slots[pos].store(slot, std::memory_order_relaxed);
+    table->keys[pos].store(key, std::memory_order_release);  // Publishes the slot
+  }
+
+  void remove(uint32_t key) {
+    HashTable* live = hash.load(std::memory_order_relaxed);
+    uint32_t mask = (1 << hashBits) - 1;
+    for (uint32_t pos = bucket(key); keyAt(live, pos) != KEY_EMPTY; pos = (pos + 1) & mask) {
+      if (keyAt(live, pos) == key) {
+        live->keys[pos].store(KEY_DELETED, std::memory_order_release);
+        deleted++;
+        break;
+      }
+    }
+
+    // Tombstones lengthen every probe; rebuild once they reach a quarter of the table,
+    // into the spare so a concurrent find() never sees it half built
+    if (deleted * 4 >= (1 << hashBits)) {
+      HashTable* spare = (live == &tables[0]) ? &tables[1] : &tables[0];
+      for (int i = 0; i < (1 << hashBits); i++) spare->keys[i].store(KEY_EMPTY, std::memory_order_relaxed);
+      deleted = 0;
+      for (int i = 0; i < used; i++) {
+        if (slotKeys[i] != key) insert(spare, slotKeys[i], i);
+      }
+      hash.store(spare, std::memory_order_release);
+    }
+  }
+};
+
+#endif  // AXLEWATCH_FLEET_H
@@ -0,0 +1,135 @@
+/**
+ * AxleWatch radio protocol shared by TX and RX
+ *
+ * Binary LoRa frames, the downlink ACK and the slotted transmit schedule.
+ * Both firmwares include this file, so the wire format is defined once.
+ * Plain C++ with no Arduino dependencies, so the encoders and decoders also
+ * build on a desktop (see tools/fleet_sim.cpp).
+ */
+
+#ifndef AXLEWATCH_FRAME_H
+#define AXLEWATCH_FRAME_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Binary frame format
+// [0]    FRAME_MAGIC (never a printable character, so RX can tell it from legacy text)
+// [1]    version (high nibble) | frame type (low nibble)
+// [2-3]  transmitter ID (uint16, little-endian)
+// [4]    sequence number (wraps at 255)
+// [5]    max silence: longest gap until the next guaranteed frame, in 10 s units (v2+)
+// [6-7]  sensor presence mask (LE, bit 0 = ambient, bit N = position N); [5-6] in v1
+// then one int16 (little-endian, centi-degrees C) per set mask bit, in bit order,
+// FRAME_CENTI_INVALID where a sensor could not be read this cycle,
+// then CRC-16/CCITT (little-endian) over everything before it
+// READINGS frames (keyframes) carry every configured sensor, DELTA frames only the changed ones
+// BATCH frames (v2+) carry stored readings instead of values right after the header:
+//   [8] reading count, then per reading: [sequence][age in seconds (uint16 LE)][values per mask]
+#define FRAME_MAGIC         0xA5
+#define FRAME_VERSION       2
+#define FRAME_TYPE_READINGS 1
+#define FRAME_TYPE_DELTA    2
+#define FRAME_TYPE_BATCH    3
+#define FRAME_HEADER_SIZE_V1 7
+#define FRAME_HEADER_SIZE   8
+#define FRAME_CRC_SIZE      2
+#define FRAME_CENTI_INVALID INT16_MIN   // Value slot without a temperature (sensor fault)
+#define BATCH_READING_HEADER_SIZE 3     // Sequence + age ahead of each stored reading
+
+// Downlink ACK (RX -> TX), sent by RX for every binary frame it accepts
+// [0] FRAME_MAGIC  [1] version | FRAME_TYPE_ACK  [2-3] addressed transmitter ID (LE)
+// [4] acknowledged sequence  [5] RSSI at RX (int8 dBm)  [6] SNR at RX (int8, 0.25 dB units)
+// [7] assigned transmit slot (0xFF = none)  [8-9] RX slot-frame phase when sent (ms, LE)
+// [10-13] RX UTC seconds when sent (LE, 0 = RX clock not synced)  [14-15] UTC milliseconds (LE)
+// then CRC-16/CCITT (LE); TX still accepts the 12-byte form without [10-15] and
+// the 9-byte form without [7-15]
+#define FRAME_TYPE_ACK      4
+#define ACK_FRAME_SIZE      18
+#define ACK_FRAME_SIZE_V2   12
+#define ACK_FRAME_SIZE_V1   9
+
+// Slotted transmit schedule
+// Time is divided into frames of SLOT_COUNT slots; each TX sends at the start of its slot.
+// RX hands each active transmitter a slot of its own while any are free; a TX
+// given none (0xFF) keeps adding SLOT_JITTER_MS of random delay instead
+#define SLOT_COUNT          10
+#define SLOT_LENGTH_MS      500         // Frame airtime + ACK window + LBT backoff
+#define SLOT_FRAME_MS       (SLOT_COUNT * SLOT_LENGTH_MS)
+#define SLOT_JITTER_MS      (SLOT_LENGTH_MS / 2)  // Random delay while TX holds no slot
+
+/**
+ * CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)
+ */
+inline uint16_t crc16(const uint8_t* data, size_t len) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (int b = 0; b < 8; b++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+    }
+  }
+  return crc;
+}
+
+/**
+ * Write a current-version frame header, returns its length
+ */
+inline size_t frameWriteHeader(uint8_t* frame, uint8_t type, uint16_t txId, uint8_t sequence,
+                               uint8_t maxSilence10s, uint16_t mask) {
+  frame[0] = FRAME_MAGIC;
+  frame[1] = (FRAME_VERSION << 4) | type;
+  frame[2] = txId & 0xFF;
+  frame[3] = txId >> 8;
+  frame[4] = sequence;
+  frame[5] = maxSilence10s;
+  frame[6] = mask & 0xFF;
+  frame[7] = mask >> 8;
+  return FRAME_HEADER_SIZE;
+}
+
+/**
+ * Append one little-endian centi-degree value, returns the new length
+ */
+inline size_t frameAppendCenti(uint8_t* frame, size_t len, int16_t centi) {
+  frame[len++] = centi & 0xFF;
+  frame[len++] = (uint16_t)centi >> 8;
+  return len;
+}
+
+/**
+ * Append the CRC, returns the final frame length
+ */
+inline size_t frameFinish(uint8_t* frame, size_t len) {
+  uint16_t crc = crc16(frame, len);
+  frame[len++] = crc & 0xFF;
+  frame[len++] = crc >> 8;
+  return len;
+}
+
+/**
+ * True if the trailing CRC matches everything before it
+ */
+inline bool frameCrcValid(const uint8_t* frame, size_t len) {
+  if (len < FRAME_CRC_SIZE) return false;
+  uint16_t crc = frame[len - 2] | (frame[len - 1] << 8);
+  return crc16(frame, len - FRAME_CRC_SIZE) == crc;
+}
+
+/**
+ * Values a presence mask carries (its set bits)
+ */
+inline int frameValueCount(uint16_t mask) {
+  int count = 0;
+  for (; mask; mask &= mask - 1) count++;
+  return count;
+}
+
+/**
+ * Read one little-endian centi-degree value
+ */
+inline int16_t frameReadCenti(const uint8_t* p) {
+  return (int16_t)(p[0] | (p[1] << 8));
+}
+
+#endif  // AXLEWATCH_FRAME_H
@@ -0,0 +1,51 @@
+/**
+ * AxleWatch serial log ring (TX web monitor)
+ *
+ * A preallocated arena of fixed-length records, so logging never touches the
+ * heap. Every entry also has a sequence number (its position in the stream
+ * of everything ever logged), which /api/serial and the log event stream
+ * page by. Plain C++ like axlewatch_frame.h, so it also builds on a desktop
+ * (see tools/fleet_sim.cpp --selftest).
+ *
+ * Not locked: TX wraps every call in logMutex.
+ */
+
+#ifndef AXLEWATCH_LOG_H
+#define AXLEWATCH_LOG_H
+
+#include <stdint.h>
+
+template <int CAPACITY, int MESSAGE_LENGTH>
+struct LogRing {
+  struct Entry {
+    unsigned long timestamp;
+    char message[MESSAGE_LENGTH];
+  };
+
+  Entry entries[CAPACITY];
+  int index = 0;                   // Next record to fill
+  int count = 0;                   // Records held (up to CAPACITY)
+  unsigned long written = 0;       // Entries ever logged = sequence of the next one
+
+  // Record to format the next entry into; it becomes visible at commit()
+  Entry* next() { return &entries[index]; }
+
+  void commit() {
+    index = (index + 1) % CAPACITY;
+    if (count < CAPACITY) count++;
+    written++;
+  }
+
+  // Sequence of the oldest entry still held
+  unsigned long oldest() const { return written - count; }
+
+  // Copy entry `sequence` out; false if it has not been written yet or was already overwritten
+  bool copy(unsigned long sequence, Entry* out) const {
+    if (sequence >= written || written - sequence > (unsigned long)count) return false;
+    unsigned long back = written - sequence;
+    *out = entries[(index - back + CAPACITY) % CAPACITY];
+    return true;
+  }
+};
+
+#endif  // AXLEWATCH_LOG_H
@@ -0,0 +1,64 @@
+/**
+ * AxleWatch stage timing shared by TX and RX (/api/perf)
+ *
+ * A PerfStage accumulates durations in microseconds: count, min, max, total
+ * and a power-of-two histogram the percentiles are read from. Recording is a
+ * handful of integer operations and no allocation, so it can stay on in the
+ * field. Plain C++ like axlewatch_frame.h, so it also builds on a desktop.
+ *
+ * Each stage is written from one task only; readers take a copy and may see
+ * one sample half applied, which a monitoring endpoint can live with.
+ */
+
+#ifndef AXLEWATCH_PERF_H
+#define AXLEWATCH_PERF_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Bucket 0 holds 0-1 us, bucket b holds [2^b, 2^(b+1)) us; the last one is open
+// ended (from 2^23 us = 8.4 s), so percentiles are good to a factor of two
+#define PERF_BUCKETS 24
+
+struct PerfStage {
+  uint32_t count;
+  uint32_t minUs;
+  uint32_t maxUs;
+  uint64_t totalUs;
+  uint32_t buckets[PERF_BUCKETS];
+
+  void record(uint32_t us) {
+    if (count == 0 || us < minUs) minUs = us;
+    if (us > maxUs) maxUs = us;
+    count++;
+    totalUs += us;
+    int bucket = 31 - __builtin_clz(us | 1);
+    buckets[bucket < PERF_BUCKETS ? bucket : PERF_BUCKETS - 1]++;
+  }
+
+  uint32_t averageUs() const {
+    return count ? (uint32_t)(totalUs / count) : 0;
+  }
+
+  // Upper edge of the bucket holding the `fraction` quantile, capped at maxUs
+  uint32_t percentileUs(float fraction) const {
+    if (count == 0) return 0;
+    uint32_t rank = (uint32_t)(fraction * count);
+    if (rank >= count) rank = count - 1;
+    uint32_t seen = 0;
+    for (int b = 0; b < PERF_BUCKETS - 1; b++) {
+      seen += buckets[b];
+      if (seen > rank) {
+        uint32_t edge = (2UL << b) - 1;
+        return edge < maxUs ? edge : maxUs;
+      }
+    }
+    return maxUs;
+  }
+
+  void reset() {
+    memset(this, 0, sizeof(*this));
+  }
+};
+
+#endif  // AXLEWATCH_PERF_H
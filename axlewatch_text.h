@@ -0,0 +1,116 @@
+/**
+ * AxleWatch legacy text frames (RX side)
+ *
+ * Older transmitters send "TX<ID>:pos1,...,pos9,ambient" in plain text; RX
+ * still accepts them during rollout. Plain C++ like axlewatch_frame.h, so the
+ * parser also builds on a desktop (see tools/fleet_sim.cpp).
+ */
+
+#ifndef AXLEWATCH_TEXT_H
+#define AXLEWATCH_TEXT_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "axlewatch_fleet.h"
+
+/**
+ * Fixed-point decimal ("-12.34") to centi-degrees, rounding past two places
+ * Advances *cursor past the number; false if there is none or it overflows int16
+ */
+inline bool parseCenti(const char** cursor, int16_t* centi) {
+  const char* p = *cursor;
+  bool negative = (*p == '-');
+  if (negative) p++;
+
+  int32_t value = 0;
+  int digits = 0;
+  while (*p >= '0' && *p <= '9') {
+    value = value * 10 + (*p++ - '0') * 100;
+    if (value > 32768) return false;
+    digits++;
+  }
+
+  if (*p == '.') {
+    p++;
+    int decimals = 0;
+    while (*p >= '0' && *p <= '9') {
+      if (decimals < 2) {
+        value += (*p - '0') * (decimals == 0 ? 10 : 1);
+      } else if (decimals == 2 && *p >= '5') {
+        value++;  // Round on the third decimal, ignore the rest
+      }
+      decimals++;
+      p++;
+      digits++;
+    }
+  }
+
+  if (digits == 0 || value > (negative ? 32768 : 32767)) return false;
+
+  *centi = (int16_t)(negative ? -value : value);
+  *cursor = p;
+  return true;
+}
+
+/**
+ * Validate and decode a legacy text frame in one pass straight into tx (ID and
+ * temperatures; the caller stamps lastReceived). Values go through parseCenti()
+ * and storeValue(), the binary decoder's path. On failure, why the packet was
+ * rejected is written to `error` (empty for a packet that is simply not text)
+ */
+inline bool parseTextPacket(const char* packet, TransmitterData* tx, char* error, size_t errorSize) {
+  // Expected format: TX<ID>:pos1,pos2,...,pos9,ambient OR TRAILER<ID>:... OR DOLLY<ID>:...
+  // Example: TX001:45.2,46.1,0.0,0.0,44.8,45.5,0.0,0.0,0.0,22.5
+  // Example: TRAILER1:23.5,23.4,23.5,0.0,0.0,0.0,0.0,0.0,0.0,23.3
+  // Example: DOLLY2:23.8,22.6,22.7,0.0,0.0,0.0,0.0,0.0,0.0,22.8
+  error[0] = '\0';
+
+  // Accept "TX", "TRAILER", or "DOLLY" prefixes
+  bool validPrefix = (strncmp(packet, "TX", 2) == 0) ||
+                     (strncmp(packet, "TRAILER", 7) == 0) ||
+                     (strncmp(packet, "DOLLY", 5) == 0);
+  if (!validPrefix) return false;
+
+  // Transmitter ID is everything before the colon
+  const char* p = packet;
+  size_t idLen = 0;
+  while (*p != ':') {
+    char c = *p;
+    bool valid = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+                 (c >= '0' && c <= '9') || c == '.' || c == '-';
+    if (!valid) {
+      // Corruption, or the packet ends before the colon
+      snprintf(error, errorSize, "Invalid character in ID at position %d: 0x%02X",
+               (int)(p - packet), (uint8_t)c);
+      return false;
+    }
+    if (idLen >= sizeof(tx->txID) - 1) return false;
+    tx->txID[idLen++] = c;
+    p++;
+  }
+  tx->txID[idLen] = '\0';
+  p++;
+
+  // 9 positions then ambient, comma-separated: anything else (stray characters,
+  // a double decimal point like "23.3.4", missing or extra values) is corruption
+  for (int field = 0; field <= NUM_TEMP_SENSORS; field++) {
+    int16_t centi;
+    if (!parseCenti(&p, &centi)) {
+      snprintf(error, errorSize, "Invalid value %d at position %d", field + 1, (int)(p - packet));
+      return false;
+    }
+    storeValue(tx, field < NUM_TEMP_SENSORS ? field + 1 : 0, centi);
+
+    char separator = (field < NUM_TEMP_SENSORS) ? ',' : '\0';
+    if (*p != separator) {
+      snprintf(error, errorSize, "Unexpected 0x%02X after value %d", (uint8_t)*p, field + 1);
+      return false;
+    }
+    p++;
+  }
+  return true;
+}
+
+#endif  // AXLEWATCH_TEXT_H
@@ -0,0 +1,182 @@
+// Generated by tools/build_web_assets.py from web/rx_*.html - do not edit
+#pragma once
+
+#include <Arduino.h>
+
+// rx_config.html: 2793 bytes, 1138 gzipped
+#define RX_CONFIG_HTML_ETAG "\"5bca705edc0af1d3\""
+const size_t RX_CONFIG_HTML_GZ_LEN = 1138;
+const uint8_t RX_CONFIG_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x56, 0x5d, 0x6e, 0xe3, 0x36,
+  0x10, 0x7e, 0xdf, 0x53, 0x4c, 0x55, 0x14, 0x71, 0x80, 0xf8, 0x47, 0xd9, 0xdd, 0x6c, 0x6b, 0x4b,
+  0x02, 0xb2, 0x49, 0x16, 0x08, 0x9a, 0x22, 0xc1, 0x26, 0xdb, 0xa0, 0x8f, 0x94, 0x48, 0x59, 0xac,
+  0x29, 0x52, 0xa5, 0xa8, 0xd8, 0xee, 0x62, 0x5f, 0x7b, 0x80, 0x9e, 0xa4, 0x67, 0xe8, 0x51, 0x7a,
+  0x92, 0x0e, 0x49, 0xc9, 0x96, 0x9d, 0x20, 0xd9, 0x3e, 0x14, 0x79, 0x88, 0x38, 0xe4, 0x7c, 0xf3,
+  0xcd, 0xf0, 0x9b, 0xa1, 0xa3, 0x6f, 0xce, 0xaf, 0xcf, 0xee, 0x7e, 0xb9, 0xb9, 0x80, 0xc2, 0x94,
+  0x22, 0x79, 0x15, 0x75, 0xff, 0x18, 0xa1, 0xc9, 0x2b, 0x80, 0xc8, 0x70, 0x23, 0x58, 0x72, 0xba,
+  0x12, 0xec, 0x9e, 0x98, 0xac, 0x80, 0x33, 0x25, 0x73, 0x3e, 0x8f, 0xc6, 0xde, 0x6e, 0x4f, 0x94,
+  0xcc, 0x10, 0x90, 0xa4, 0x64, 0x71, 0xf0, 0xc0, 0xd9, 0xb2, 0x52, 0xda, 0x04, 0x90, 0x29, 0x69,
+  0x98, 0x34, 0x71, 0xb0, 0xe4, 0xd4, 0x14, 0x31, 0x65, 0x0f, 0x3c, 0x63, 0x43, 0xb7, 0x38, 0x02,
+  0x2e, 0xb9, 0xe1, 0x44, 0x0c, 0xeb, 0x8c, 0x08, 0x16, 0x87, 0x81, 0x83, 0xa9, 0xcd, 0xda, 0x03,
+  0x02, 0xa4, 0x8a, 0xae, 0xe1, 0x33, 0xe4, 0x88, 0x31, 0xcc, 0x49, 0xc9, 0xc5, 0x7a, 0x0a, 0xa7,
+  0x1a, 0x3d, 0x66, 0x50, 0x12, 0x3d, 0xe7, 0x72, 0x0a, 0xc7, 0x93, 0x6a, 0x35, 0x83, 0x94, 0x64,
+  0x8b, 0xb9, 0x56, 0x8d, 0xa4, 0x53, 0xf8, 0x36, 0x9f, 0xd8, 0xbf, 0x19, 0x7c, 0x71, 0x18, 0x23,
+  0xcb, 0x80, 0x70, 0xc9, 0x34, 0x22, 0x95, 0x64, 0xe5, 0x63, 0x4f, 0xe1, 0x64, 0xe2, 0x3c, 0x3b,
+  0x1c, 0xd2, 0x18, 0xb5, 0x8b, 0xb3, 0x2c, 0xb8, 0x61, 0x33, 0xa8, 0x08, 0xa5, 0x5c, 0xce, 0x37,
+  0x91, 0x94, 0xa6, 0x4c, 0x0f, 0x35, 0xa1, 0xbc, 0xa9, 0xa7, 0xf0, 0xbd, 0xb5, 0xf9, 0x40, 0x45,
+  0x88, 0x01, 0x32, 0x25, 0x94, 0x46, 0x0e, 0xc7, 0xe1, 0x0f, 0x27, 0x1f, 0x5e, 0x77, 0x5b, 0x82,
+  0xa4, 0x4c, 0xe0, 0x2e, 0xe5, 0x75, 0x25, 0x08, 0x26, 0x91, 0x0a, 0x95, 0x2d, 0xba, 0xe0, 0x43,
+  0xa3, 0xaa, 0x29, 0x84, 0x6f, 0x2d, 0x94, 0x4b, 0x75, 0xc9, 0xf8, 0xbc, 0x30, 0x78, 0x4a, 0x09,
+  0xda, 0x41, 0x70, 0x59, 0x35, 0xe6, 0x08, 0xd2, 0xc6, 0x18, 0x25, 0x11, 0xaa, 0xcd, 0x22, 0x9c,
+  0x4c, 0xbe, 0xeb, 0x71, 0x0c, 0x7b, 0x39, 0x79, 0xd8, 0xb7, 0x9e, 0xf4, 0x6a, 0x58, 0xf3, 0xdf,
+  0xdd, 0x91, 0x36, 0x01, 0x34, 0x75, 0xd0, 0x1b, 0xcc, 0x9d, 0x2a, 0x76, 0x19, 0xb4, 0x19, 0xb5,
+  0xd5, 0xf0, 0xde, 0x53, 0x90, 0x4a, 0xe2, 0x2a, 0x6b, 0x74, 0x6d, 0x37, 0x2b, 0xc5, 0xf1, 0x96,
+  0x75, 0x4b, 0x1f, 0x23, 0x31, 0xa4, 0x72, 0x52, 0xed, 0x45, 0x98, 0x16, 0xea, 0xc1, 0xdd, 0xc2,
+  0x4e, 0x9c, 0x49, 0xfa, 0x8e, 0x52, 0xb2, 0xb9, 0xad, 0xda, 0x10, 0xd3, 0xd4, 0xfb, 0x87, 0xd8,
+  0xbb, 0xfc, 0x75, 0x9e, 0x3f, 0x4a, 0xb4, 0xcd, 0x45, 0xb0, 0x1c, 0xab, 0xf5, 0xa6, 0x5a, 0x41,
+  0xad, 0x04, 0xa7, 0x5b, 0xee, 0x6d, 0x21, 0x52, 0x85, 0xe1, 0xcb, 0xee, 0x06, 0x6d, 0xa0, 0x68,
+  0xdc, 0xaa, 0x2c, 0x1a, 0x7b, 0x81, 0x47, 0x56, 0x6a, 0x4e, 0x7e, 0x94, 0x3f, 0x40, 0x26, 0x48,
+  0x5d, 0xc7, 0xc1, 0x46, 0x39, 0x81, 0x97, 0x63, 0x54, 0x84, 0xbd, 0x06, 0xf8, 0xc8, 0x32, 0xc6,
+  0x6d, 0x42, 0xbe, 0x13, 0x1a, 0x4d, 0x0c, 0x57, 0x12, 0x01, 0xc3, 0xf6, 0x74, 0x0f, 0xc9, 0x67,
+  0xd5, 0xc2, 0x38, 0x8d, 0x6b, 0x25, 0xe7, 0xc9, 0xb9, 0xeb, 0x06, 0xb8, 0x3c, 0x9f, 0x5a, 0x42,
+  0xce, 0x84, 0x7b, 0x15, 0x91, 0xc0, 0x69, 0x1c, 0xf8, 0x5e, 0xb9, 0xa4, 0x41, 0x32, 0xc4, 0x6d,
+  0xb4, 0x26, 0x51, 0xaa, 0xf7, 0x21, 0x6e, 0x1d, 0x72, 0xcf, 0x7f, 0x87, 0x0d, 0xfc, 0xa4, 0x28,
+  0x7b, 0xc2, 0x2b, 0x22, 0x50, 0x68, 0x96, 0xc7, 0xc1, 0x58, 0x60, 0x0a, 0x01, 0xb8, 0x6a, 0xd8,
+  0x84, 0x77, 0xd4, 0x1b, 0x24, 0x3f, 0x63, 0x1f, 0xc3, 0x15, 0x1e, 0x81, 0x73, 0x52, 0x17, 0xa9,
+  0x22, 0x9a, 0xc2, 0x3f, 0x7f, 0xfc, 0x19, 0x8d, 0x49, 0xb2, 0x89, 0xe8, 0x93, 0x1d, 0x63, 0xb6,
+  0xed, 0x67, 0xae, 0x74, 0x09, 0x24, 0xb3, 0xf1, 0x31, 0x40, 0x4d, 0x6c, 0x00, 0x9c, 0x0d, 0x85,
+  0xc2, 0x9c, 0x6e, 0xae, 0x6f, 0xef, 0xb6, 0x65, 0x70, 0x7d, 0x91, 0xdc, 0xf3, 0x0f, 0x1c, 0x6e,
+  0x6f, 0x5d, 0x15, 0xbc, 0xa5, 0xdb, 0x77, 0xa2, 0x07, 0xb3, 0xae, 0x90, 0x9b, 0x61, 0x2b, 0x1c,
+  0x27, 0x7e, 0xbc, 0xd4, 0x35, 0xa7, 0x81, 0xab, 0x91, 0xff, 0xd2, 0xec, 0xb7, 0x86, 0x6b, 0x86,
+  0xf7, 0xf8, 0x04, 0xf2, 0x0d, 0xde, 0xc0, 0x12, 0x85, 0xf2, 0x2c, 0x7a, 0xd5, 0x1e, 0xea, 0x22,
+  0x6c, 0xd7, 0xd8, 0xb0, 0x19, 0x2b, 0xb0, 0x13, 0x99, 0x8e, 0x83, 0x2b, 0x86, 0xd9, 0x60, 0xf7,
+  0x12, 0xb9, 0x00, 0xa3, 0x60, 0xc1, 0x58, 0x05, 0xa6, 0x60, 0x60, 0x93, 0xa4, 0xb0, 0x71, 0xda,
+  0xe7, 0x71, 0x26, 0x54, 0x43, 0xe1, 0x42, 0x52, 0xd7, 0x28, 0xf0, 0xe9, 0xe3, 0xd5, 0x57, 0xa7,
+  0xca, 0x5a, 0x27, 0x9f, 0xee, 0x66, 0xf5, 0x74, 0x84, 0xd3, 0x9b, 0x4b, 0xf8, 0x91, 0xad, 0xff,
+  0x53, 0xa6, 0xa4, 0xe2, 0xe8, 0xb2, 0x97, 0xe7, 0x85, 0x6d, 0x67, 0x07, 0xb7, 0x60, 0x6b, 0xc8,
+  0xb5, 0xc2, 0x0b, 0x45, 0xe1, 0x2f, 0xad, 0xf0, 0x71, 0xa0, 0x96, 0x30, 0xf0, 0x35, 0xb0, 0x05,
+  0xa8, 0x7b, 0x15, 0xc0, 0xd3, 0x87, 0x8f, 0xb8, 0xdd, 0x13, 0x2d, 0xb1, 0x69, 0xe1, 0x0e, 0x25,
+  0x57, 0xdb, 0x08, 0x30, 0xf8, 0xfb, 0xaf, 0x33, 0x20, 0x29, 0x8e, 0x03, 0x20, 0x65, 0xca, 0xf1,
+  0x7d, 0x38, 0x7c, 0x96, 0xb3, 0x6c, 0xca, 0x14, 0xbb, 0x10, 0x65, 0xca, 0xaa, 0x38, 0x98, 0x8c,
+  0xc2, 0x8e, 0xfc, 0x12, 0xa1, 0xaf, 0xf3, 0xbc, 0x66, 0x6d, 0x7d, 0x7a, 0xeb, 0x47, 0x15, 0xd2,
+  0xf8, 0xd6, 0xe0, 0x3b, 0xf3, 0x7f, 0xd0, 0xc8, 0x10, 0xbb, 0x4f, 0xa3, 0xb7, 0xde, 0xa7, 0x81,
+  0x66, 0x81, 0x23, 0x05, 0xde, 0xe3, 0x78, 0x13, 0x6a, 0x8e, 0x53, 0xc4, 0xbe, 0x08, 0x58, 0xcf,
+  0xb5, 0x61, 0x35, 0x54, 0x58, 0xf5, 0x92, 0xcb, 0xc6, 0xb0, 0x23, 0x98, 0x40, 0x0c, 0x2a, 0xcf,
+  0xbf, 0x8e, 0x12, 0x3a, 0x21, 0xa3, 0x8e, 0x5a, 0x38, 0x39, 0x7e, 0xd3, 0x71, 0xd3, 0x2e, 0xc0,
+  0xfb, 0x86, 0xce, 0x3b, 0x76, 0x3b, 0x96, 0x7d, 0x7e, 0xed, 0x6a, 0x2f, 0x4c, 0x56, 0xb0, 0x6c,
+  0x81, 0x4f, 0xc6, 0x26, 0x61, 0x2b, 0xb7, 0x0b, 0x49, 0x52, 0xc1, 0xda, 0x46, 0xdc, 0xb5, 0x3c,
+  0x10, 0xd1, 0xe0, 0xb1, 0x30, 0xd8, 0xe2, 0xf9, 0x3d, 0xf0, 0x42, 0xfd, 0x54, 0x09, 0x45, 0x68,
+  0x17, 0xb9, 0xcb, 0xaf, 0x5b, 0xb7, 0x0f, 0x92, 0x0f, 0x5d, 0x37, 0x69, 0xc9, 0x91, 0xe7, 0xad,
+  0xed, 0xbc, 0xbd, 0x51, 0xeb, 0x0f, 0x76, 0x13, 0xc8, 0xce, 0x1d, 0x37, 0xc2, 0xbb, 0x59, 0x14,
+  0xd5, 0x78, 0x11, 0x95, 0xb1, 0x9f, 0x39, 0x43, 0xe5, 0x0e, 0x0e, 0xc6, 0xa8, 0xf6, 0x71, 0xe6,
+  0x40, 0x0e, 0x0e, 0x47, 0xa8, 0x5b, 0x39, 0xd0, 0x71, 0xa2, 0x47, 0xbf, 0xd6, 0x4a, 0x0e, 0x0e,
+  0x5b, 0x4b, 0x16, 0x27, 0x9f, 0x1d, 0x24, 0x55, 0x59, 0x53, 0xa2, 0x2a, 0x46, 0x58, 0xa8, 0x0b,
+  0xc1, 0xec, 0xe7, 0xfb, 0xf5, 0x25, 0x1d, 0x1c, 0x74, 0x93, 0xd9, 0x62, 0x60, 0xaf, 0x9e, 0xb5,
+  0xbf, 0x71, 0xb2, 0x51, 0xbb, 0x71, 0x3e, 0x7b, 0xde, 0xdf, 0x4e, 0x2d, 0xf4, 0xf5, 0x55, 0xca,
+  0x46, 0x4b, 0x9e, 0x73, 0x3b, 0xff, 0x5e, 0xf0, 0xea, 0x9a, 0xbf, 0xe7, 0xd9, 0x56, 0xdd, 0xdb,
+  0x5f, 0x70, 0xdf, 0xf6, 0x46, 0x3f, 0xf4, 0xc6, 0xf8, 0x82, 0xf7, 0x56, 0xd2, 0xfd, 0xf0, 0x1b,
+  0xe3, 0x0b, 0xde, 0x7d, 0xc9, 0xf5, 0xfc, 0xfb, 0xe6, 0x97, 0xe2, 0xf7, 0xf4, 0x85, 0x08, 0x4e,
+  0x90, 0x8c, 0x6e, 0x4b, 0xe0, 0x36, 0x2c, 0xc6, 0x97, 0xc3, 0x99, 0x7f, 0xe0, 0xdb, 0xbb, 0x47,
+  0x95, 0xb8, 0xa7, 0x1d, 0x1f, 0x66, 0xf7, 0x8b, 0xf6, 0x5f, 0x03, 0x7a, 0x41, 0xbd, 0xe9, 0x0a,
+  0x00, 0x00,
+};
+
+// rx_live.html: 3627 bytes, 1497 gzipped
+#define RX_LIVE_HTML_ETAG "\"32ce7f434c7f98a3\""
+const size_t RX_LIVE_HTML_GZ_LEN = 1497;
+const uint8_t RX_LIVE_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x57, 0xdd, 0x6e, 0xdb, 0x36,
+  0x14, 0xbe, 0xef, 0x53, 0x70, 0xee, 0x85, 0x64, 0x24, 0x96, 0xff, 0xd2, 0xce, 0xb5, 0x2d, 0x17,
+  0x59, 0x92, 0xae, 0x19, 0xba, 0xb6, 0x48, 0x02, 0x14, 0xc3, 0x50, 0xa0, 0x94, 0x78, 0x64, 0xb3,
+  0x95, 0x49, 0x81, 0xa4, 0x62, 0x7b, 0x69, 0x6e, 0x77, 0xbd, 0x47, 0xd9, 0x33, 0xec, 0x51, 0xf6,
+  0x24, 0x3b, 0xa4, 0x7e, 0x2c, 0xc7, 0x49, 0x86, 0x62, 0x18, 0x02, 0x24, 0x12, 0xc9, 0xf3, 0x9d,
+  0xef, 0x9c, 0xf3, 0x9d, 0x43, 0x65, 0xfa, 0xdd, 0xe9, 0xbb, 0x93, 0xab, 0x5f, 0xde, 0x9f, 0x91,
+  0x85, 0x59, 0xa6, 0xb3, 0x27, 0xd3, 0xea, 0x0f, 0x50, 0x36, 0x7b, 0x42, 0xc8, 0xd4, 0x70, 0x93,
+  0xc2, 0xec, 0x78, 0x9d, 0xc2, 0x07, 0x6a, 0xe2, 0x05, 0x79, 0xc3, 0xaf, 0x61, 0xda, 0x2d, 0x56,
+  0xed, 0xfe, 0x12, 0x0c, 0x25, 0x82, 0x2e, 0x21, 0x6c, 0x5d, 0x73, 0x58, 0x65, 0x52, 0x99, 0x16,
+  0x89, 0xa5, 0x30, 0x20, 0x4c, 0xd8, 0x5a, 0x71, 0x66, 0x16, 0x21, 0x83, 0x6b, 0x1e, 0x43, 0xc7,
+  0xbd, 0x1c, 0x12, 0x2e, 0xb8, 0xe1, 0x34, 0xed, 0xe8, 0x98, 0xa6, 0x10, 0xf6, 0x5b, 0x0e, 0x46,
+  0x9b, 0x4d, 0x01, 0x48, 0x48, 0x24, 0xd9, 0x86, 0xdc, 0x90, 0x04, 0x31, 0x3a, 0x09, 0x5d, 0xf2,
+  0x74, 0x33, 0x26, 0xc7, 0x0a, 0x2d, 0x26, 0x64, 0x49, 0xd5, 0x9c, 0x8b, 0x31, 0x19, 0xf4, 0xb2,
+  0xf5, 0x84, 0x44, 0x34, 0xfe, 0x32, 0x57, 0x32, 0x17, 0x6c, 0x4c, 0x9e, 0xf6, 0xa2, 0xfe, 0x60,
+  0xd0, 0x9b, 0xa0, 0xeb, 0x54, 0x2a, 0x7c, 0x87, 0x11, 0x40, 0x12, 0x4f, 0xc8, 0xad, 0xc3, 0x0c,
+  0x2c, 0x23, 0xca, 0x05, 0x28, 0x44, 0x5e, 0xd2, 0x75, 0xc1, 0x65, 0x4c, 0x46, 0x3d, 0x87, 0x54,
+  0xe1, 0xd2, 0xdc, 0xc8, 0xca, 0x64, 0xd1, 0xc7, 0xa3, 0x15, 0xda, 0x51, 0x1c, 0xbf, 0x48, 0x7a,
+  0x5b, 0x34, 0xaa, 0x18, 0xee, 0xee, 0x10, 0xe8, 0x1f, 0xf5, 0xa3, 0x01, 0x43, 0x56, 0x52, 0x31,
+  0x40, 0x9b, 0x7e, 0xb6, 0x26, 0x5a, 0xa6, 0x9c, 0x91, 0xa7, 0xc3, 0xe1, 0x51, 0xb5, 0xde, 0x51,
+  0x94, 0xf1, 0x5c, 0xe3, 0xb6, 0x73, 0x9c, 0x51, 0xc6, 0xb8, 0x98, 0x57, 0x11, 0x55, 0x3c, 0xfa,
+  0xcf, 0xd1, 0xf8, 0x8e, 0xbb, 0xc5, 0xe0, 0x1e, 0x3e, 0x95, 0x41, 0x0f, 0x7f, 0xac, 0x51, 0x6d,
+  0x32, 0x57, 0xdc, 0x32, 0x64, 0x5c, 0x67, 0x29, 0xc5, 0x04, 0xda, 0xf7, 0x89, 0xfb, 0xdd, 0x31,
+  0xb0, 0xc4, 0x35, 0x03, 0x1d, 0x04, 0xcb, 0x97, 0x02, 0xb9, 0x28, 0xc8, 0x80, 0x1a, 0xdf, 0x46,
+  0xdf, 0x49, 0xb8, 0x39, 0x24, 0x4b, 0x2e, 0x30, 0x49, 0x7e, 0xff, 0x08, 0x59, 0x1d, 0x92, 0x7e,
+  0xa2, 0xda, 0x6d, 0x34, 0xa6, 0x19, 0x32, 0x1b, 0x34, 0x9c, 0x68, 0x10, 0x5a, 0xaa, 0x4e, 0x24,
+  0xd7, 0x7b, 0xc9, 0xa0, 0x83, 0xe1, 0x70, 0xb0, 0x4d, 0xc6, 0x60, 0x9b, 0x8c, 0xa3, 0xa3, 0x67,
+  0x7b, 0xc9, 0x18, 0xed, 0xe4, 0xa2, 0x08, 0xc4, 0xc0, 0xda, 0x74, 0x68, 0xca, 0xe7, 0x18, 0x5e,
+  0x8c, 0x62, 0x02, 0x75, 0x9f, 0xdf, 0xc5, 0xb0, 0x92, 0x8a, 0xe6, 0xbf, 0x01, 0xda, 0x1e, 0x35,
+  0xf3, 0x68, 0xd3, 0xe2, 0xb0, 0x65, 0x46, 0x63, 0x6e, 0x30, 0x0f, 0xc1, 0x8b, 0xc9, 0x43, 0x45,
+  0x6d, 0xa0, 0x06, 0x36, 0x47, 0xbb, 0xc0, 0x43, 0x17, 0xb8, 0x5b, 0x58, 0x01, 0x9f, 0x2f, 0xcc,
+  0x18, 0x83, 0x48, 0xd9, 0x16, 0xed, 0xfb, 0x88, 0x8d, 0x46, 0xc9, 0x16, 0xcd, 0x50, 0x93, 0xeb,
+  0x8e, 0x92, 0xab, 0x66, 0x19, 0x92, 0x14, 0x10, 0xe5, 0x73, 0xae, 0x0d, 0x4f, 0x36, 0x9d, 0xb2,
+  0x4d, 0xc6, 0x44, 0x23, 0x3d, 0xe8, 0x44, 0x60, 0x56, 0x00, 0xa2, 0x91, 0x89, 0x51, 0x21, 0x83,
+  0x32, 0x5b, 0x91, 0x34, 0x46, 0x2e, 0xf7, 0x95, 0xb5, 0xeb, 0x31, 0xa5, 0x11, 0xa4, 0x0d, 0xa9,
+  0x8c, 0x46, 0xa3, 0xc9, 0x7e, 0x86, 0x76, 0x6d, 0xae, 0x69, 0x9a, 0xc3, 0x3d, 0xf2, 0xda, 0x09,
+  0xf7, 0x79, 0xaf, 0xf7, 0x20, 0x10, 0xbd, 0xc7, 0xd8, 0x15, 0x90, 0x41, 0x2c, 0x15, 0x35, 0x5c,
+  0x62, 0x35, 0x84, 0x14, 0x50, 0x18, 0x4c, 0xbb, 0x65, 0xbf, 0x4f, 0xbb, 0xc5, 0xa0, 0x99, 0xda,
+  0xa6, 0x77, 0x83, 0x80, 0xf1, 0x6b, 0x12, 0xa7, 0x54, 0xeb, 0xb0, 0x55, 0xf7, 0x6c, 0xab, 0x18,
+  0x0c, 0xd3, 0x45, 0xff, 0xce, 0x20, 0x22, 0xa7, 0x54, 0x2f, 0x22, 0x89, 0xed, 0x81, 0x40, 0xfd,
+  0xf2, 0x54, 0x36, 0x9b, 0x52, 0xb2, 0x50, 0x90, 0x84, 0xad, 0x6e, 0x6b, 0xf6, 0xf7, 0xef, 0x7f,
+  0x90, 0x1f, 0x50, 0x9a, 0xc4, 0x48, 0x72, 0x22, 0x45, 0xc2, 0xe7, 0x79, 0xc1, 0x67, 0xda, 0xa5,
+  0xb3, 0x69, 0x37, 0x2b, 0x8d, 0x9a, 0x6e, 0x11, 0xae, 0xf4, 0x68, 0x7d, 0x0e, 0x66, 0xc7, 0xb1,
+  0xb1, 0xbe, 0xae, 0x14, 0x15, 0x7a, 0xc9, 0x0d, 0x2a, 0x51, 0xa3, 0xbb, 0x41, 0x7d, 0xc4, 0xda,
+  0x72, 0x16, 0xb6, 0x4c, 0xe3, 0x40, 0x0b, 0xb1, 0x71, 0xbd, 0x44, 0x6f, 0x3c, 0x3e, 0xe6, 0xe8,
+  0x72, 0xa3, 0x51, 0x78, 0xe4, 0xd2, 0x15, 0x65, 0xcf, 0x45, 0x69, 0xb5, 0x15, 0x56, 0x6d, 0x6b,
+  0xe7, 0x67, 0x46, 0xc5, 0x9d, 0x13, 0x4e, 0x08, 0xad, 0xd9, 0xa9, 0x1b, 0xbe, 0xe4, 0xfc, 0x74,
+  0x8c, 0x59, 0xc7, 0x53, 0x8f, 0x1b, 0x39, 0x25, 0xb4, 0x5c, 0x38, 0xc5, 0xd4, 0x3e, 0x47, 0x8a,
+  0x9d, 0x5d, 0xcb, 0x46, 0x38, 0xff, 0x8d, 0xda, 0x07, 0xfe, 0x8a, 0x7f, 0x2b, 0xab, 0x15, 0x4f,
+  0x78, 0x91, 0xa0, 0xff, 0x8f, 0xd7, 0x8f, 0xef, 0x2f, 0xbf, 0x95, 0xd6, 0x3c, 0xd3, 0xff, 0xce,
+  0xaa, 0x7e, 0xdc, 0x3e, 0xe8, 0x58, 0xf1, 0xcc, 0xd8, 0xc7, 0x6e, 0x97, 0xbc, 0xca, 0xd3, 0x94,
+  0x68, 0x41, 0x33, 0xbd, 0x90, 0x86, 0x48, 0x41, 0x52, 0x49, 0xd9, 0x21, 0x31, 0x0b, 0x10, 0xf8,
+  0x06, 0xe4, 0x93, 0x59, 0x7f, 0x22, 0x70, 0x8d, 0x23, 0x83, 0x64, 0x78, 0x93, 0x35, 0xf4, 0x46,
+  0xf2, 0x8c, 0xe1, 0x48, 0x47, 0x18, 0x6c, 0x1a, 0x6d, 0xec, 0x16, 0x4f, 0x51, 0x86, 0xe1, 0xcd,
+  0xed, 0x04, 0x17, 0x93, 0x5c, 0xc4, 0x56, 0xf3, 0x04, 0x81, 0x57, 0x05, 0x4f, 0x9f, 0xb5, 0x6f,
+  0x1c, 0x29, 0x26, 0xe3, 0x7c, 0x89, 0x90, 0xc1, 0x1c, 0xcc, 0x59, 0x0a, 0xf6, 0xf1, 0x87, 0xcd,
+  0x39, 0xf3, 0xbd, 0x6d, 0xa6, 0xbd, 0x76, 0x60, 0x9b, 0xf9, 0xa4, 0xbc, 0xd5, 0x59, 0x60, 0xb7,
+  0xf0, 0x4d, 0x40, 0x6c, 0x80, 0xbd, 0xf4, 0xea, 0x47, 0x6f, 0xec, 0x9d, 0x72, 0x1d, 0xd7, 0xaf,
+  0x93, 0xc7, 0x3d, 0xd4, 0x49, 0xdb, 0x73, 0x80, 0x3b, 0x41, 0xc2, 0xd7, 0x2f, 0xbd, 0x57, 0x7c,
+  0x4d, 0x7c, 0xef, 0xa0, 0x58, 0xd1, 0x18, 0x62, 0x9a, 0x72, 0x03, 0xfa, 0xc0, 0x23, 0xf8, 0xa2,
+  0xdb, 0xe8, 0xf0, 0xad, 0x24, 0x78, 0xc8, 0xb9, 0xba, 0x6d, 0x86, 0x6a, 0x47, 0xb8, 0x6f, 0xca,
+  0x20, 0x15, 0x98, 0x5c, 0xe1, 0x5a, 0x18, 0x86, 0x02, 0x93, 0xfc, 0xd2, 0x3b, 0xbb, 0xb8, 0xf0,
+  0xc6, 0x26, 0x30, 0x12, 0x6d, 0x81, 0xf9, 0xfd, 0xf6, 0x81, 0xf7, 0xd7, 0x9f, 0x27, 0xde, 0xc4,
+  0xd5, 0xc1, 0x1e, 0x21, 0x21, 0x29, 0x2e, 0x04, 0x92, 0xd0, 0x3c, 0x75, 0xd5, 0xc0, 0x3a, 0x54,
+  0x89, 0xbd, 0xeb, 0x4c, 0x81, 0xc0, 0x09, 0xed, 0x97, 0xde, 0x52, 0x30, 0xee, 0x73, 0x2a, 0xf4,
+  0xca, 0x0c, 0xbc, 0x8b, 0x3e, 0x63, 0x42, 0x82, 0x2f, 0xb0, 0xd1, 0x7e, 0x55, 0x9a, 0x76, 0x80,
+  0xe0, 0xc6, 0xf7, 0xe9, 0x61, 0xd4, 0x0e, 0x67, 0xb4, 0x13, 0xb5, 0x83, 0x44, 0xaa, 0x33, 0x1a,
+  0x2f, 0x7c, 0x14, 0xd4, 0xec, 0xa6, 0x94, 0x4f, 0x59, 0xcf, 0xb0, 0x32, 0xfb, 0x95, 0xb3, 0x8f,
+  0x93, 0x72, 0xcf, 0xfa, 0x38, 0x08, 0xbd, 0xe9, 0x62, 0x38, 0xf3, 0x0e, 0x4c, 0xc0, 0xd9, 0x81,
+  0x87, 0x53, 0x63, 0x38, 0x6b, 0x6a, 0xdf, 0x5e, 0xf9, 0xad, 0x99, 0x57, 0x99, 0x98, 0x60, 0x91,
+  0x47, 0x57, 0x98, 0x1a, 0xc0, 0x29, 0x98, 0x2b, 0xd0, 0xb5, 0x53, 0x1f, 0x37, 0x0e, 0x79, 0x7b,
+  0xeb, 0x79, 0x8b, 0xdf, 0x6c, 0xa5, 0xfa, 0x92, 0xc4, 0x09, 0x87, 0xae, 0x5e, 0xe7, 0x11, 0xf1,
+  0x0e, 0x7c, 0x7e, 0x60, 0x33, 0xb8, 0xe7, 0xdc, 0xd6, 0xa0, 0x65, 0xb9, 0xd9, 0x5a, 0x20, 0xbe,
+  0x3b, 0x63, 0xa5, 0x5f, 0xfc, 0xae, 0x59, 0xdd, 0xb6, 0xef, 0x86, 0x54, 0x9c, 0xca, 0x66, 0xc7,
+  0xcb, 0x88, 0xbb, 0x2b, 0xb2, 0x04, 0x31, 0x01, 0x2d, 0x56, 0x6c, 0x0c, 0x08, 0x47, 0xbe, 0x92,
+  0x8b, 0xcb, 0xcb, 0x73, 0xb7, 0x1f, 0x28, 0xad, 0xb9, 0xf5, 0x90, 0x55, 0xc8, 0x15, 0xee, 0x83,
+  0x0a, 0x6c, 0x8e, 0x6c, 0x14, 0x21, 0x47, 0xe1, 0xaa, 0xd7, 0x57, 0x3f, 0xbf, 0x09, 0x2d, 0x8f,
+  0xaf, 0x5f, 0x3d, 0x64, 0x80, 0xfa, 0xa2, 0xc5, 0x05, 0x60, 0x76, 0x2e, 0x80, 0xd2, 0xc9, 0x8e,
+  0x0c, 0x6c, 0xbf, 0x56, 0x22, 0x48, 0x00, 0x6f, 0x29, 0xdf, 0xeb, 0xd2, 0x8c, 0x77, 0x53, 0x34,
+  0xb7, 0x1a, 0xc7, 0x46, 0xf6, 0x55, 0x38, 0x53, 0xc1, 0x67, 0x2d, 0x85, 0xdf, 0x2e, 0x57, 0x1a,
+  0xd5, 0x7e, 0x90, 0x68, 0x35, 0x8c, 0xf7, 0x3a, 0xa5, 0xda, 0xa8, 0x12, 0xb8, 0xd3, 0xe1, 0xd5,
+  0xe2, 0xfd, 0xfa, 0x6b, 0xca, 0x8d, 0x01, 0x8a, 0xb6, 0x96, 0xb7, 0x53, 0x59, 0x6d, 0xcd, 0x82,
+  0x6a, 0xb9, 0x36, 0x31, 0x48, 0xb9, 0x3e, 0x6b, 0x95, 0xf7, 0x31, 0x34, 0x93, 0x6d, 0x15, 0xab,
+  0x76, 0x68, 0x56, 0xc1, 0x26, 0x8a, 0x27, 0xfe, 0x8a, 0x0b, 0x26, 0x57, 0xc1, 0x99, 0x9d, 0x62,
+  0x97, 0x32, 0x57, 0x31, 0x94, 0xf9, 0x2a, 0x84, 0xee, 0xa6, 0x9b, 0x0e, 0x05, 0xac, 0x48, 0xe3,
+  0x48, 0x99, 0xc6, 0x62, 0xd3, 0x2b, 0x61, 0x8b, 0xb7, 0x00, 0xbf, 0x95, 0xdc, 0xc9, 0x37, 0x1c,
+  0x2f, 0x4f, 0x2c, 0x1f, 0x16, 0x75, 0xed, 0x1d, 0xc2, 0x7e, 0x07, 0xfd, 0x74, 0xf9, 0xee, 0x6d,
+  0x90, 0x51, 0xa5, 0xc1, 0x87, 0x00, 0xa7, 0x25, 0xad, 0xe9, 0x22, 0x2d, 0x13, 0x48, 0x91, 0xe2,
+  0xb7, 0x46, 0x7b, 0x2f, 0x2a, 0x48, 0x35, 0x90, 0xbb, 0xe9, 0x71, 0x9b, 0x8f, 0x45, 0xfb, 0x08,
+  0xbd, 0xe2, 0xf2, 0x70, 0x14, 0x1b, 0xc5, 0xda, 0x67, 0xd7, 0xde, 0x05, 0x92, 0x42, 0x66, 0x20,
+  0x42, 0x2b, 0xb1, 0x62, 0x4a, 0x5d, 0x80, 0xde, 0x88, 0x98, 0xd0, 0xc4, 0xce, 0x7f, 0x3c, 0xa4,
+  0x36, 0xc4, 0x57, 0xd0, 0x2e, 0xa7, 0xaf, 0xcd, 0xb8, 0xa5, 0x5e, 0x4e, 0x24, 0x27, 0xcc, 0x02,
+  0x4f, 0x83, 0x39, 0xb7, 0x9f, 0xd3, 0x78, 0x7b, 0xf9, 0xee, 0x82, 0x79, 0xd6, 0xeb, 0xf5, 0xea,
+  0x12, 0xe1, 0xe5, 0x55, 0x5e, 0x49, 0xd3, 0x6e, 0xf1, 0x51, 0x86, 0x5d, 0xed, 0xfe, 0x27, 0xfc,
+  0x07, 0xc6, 0x72, 0x6d, 0x2d, 0x2b, 0x0e, 0x00, 0x00,
+};
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+"""
+Compress the dashboard pages in web/ into PROGMEM headers for the firmware.
+
+    python3 tools/build_web_assets.py
+
+Run after editing anything in web/ and commit the regenerated headers:
+  web/tx_*.html -> tx_web_assets.h  (AxleWatch-TX-main.cpp)
+  web/rx_*.html -> rx_web_assets.h  (AxleWatch_RX_main.ino)
+
+Each page becomes <NAME>_GZ[] / <NAME>_GZ_LEN plus <NAME>_ETAG, a quoted hash
+of the page, so browsers revalidate with If-None-Match and get a 304.
+Output is deterministic (no gzip timestamp), so unchanged pages give
+unchanged headers.
+"""
+
+import gzip
+import hashlib
+import pathlib
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+WEB = ROOT / "web"
+TARGETS = {"tx": "tx_web_assets.h", "rx": "rx_web_assets.h"}
+
+
+def symbol(path):
+    return path.stem.upper() + "_HTML"
+
+
+def render(prefix, pages):
+    out = [
+        "// Generated by tools/build_web_assets.py from web/%s_*.html - do not edit" % prefix,
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+        "",
+    ]
+    for page in pages:
+        raw = page.read_bytes()
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        name = symbol(page)
+        etag = hashlib.sha1(raw).hexdigest()[:16]
+
+        out.append("// %s: %d bytes, %d gzipped" % (page.name, len(raw), len(gz)))
+        out.append('#define %s_ETAG "\\"%s\\""' % (name, etag))
+        out.append("const size_t %s_GZ_LEN = %d;" % (name, len(gz)))
+        out.append("const uint8_t %s_GZ[] PROGMEM = {" % name)
+        for i in range(0, len(gz), 16):
+            out.append("  " + ", ".join("0x%02x" % b for b in gz[i:i + 16]) + ",")
+        out.append("};")
+        out.append("")
+    return "\n".join(out)
+
+
+def main():
+    for prefix, header in TARGETS.items():
+        pages = sorted(WEB.glob(prefix + "_*.html"))
+        (ROOT / header).write_text(render(prefix, pages))
+        print("%s: %s" % (header, ", ".join(p.name for p in pages)))
+
+
+if __name__ == "__main__":
+    main()
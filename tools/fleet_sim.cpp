@@ -0,0 +1,516 @@
+/**
+ * AxleWatch fleet simulator - desktop build of the radio protocol
+ *
+ *     g++ -std=c++17 -O2 -o fleet_sim tools/fleet_sim.cpp
+ *     ./fleet_sim --tx 40 --minutes 60 --loss 0.02 --corrupt 0.01
+ *     ./fleet_sim --tx 40 --unsynced        # no slot schedule, jitter only
+ *     ./fleet_sim --bench                   # encode/decode cost per frame
+ *     ./fleet_sim --selftest                # checks on the shared RX/TX headers
+ *
+ * Replays N transmitters sending keyframes to one receiver. The frames are built
+ * and checked with axlewatch_frame.h and transmit slots handed out by the RX's
+ * FleetTable (axlewatch_fleet.h), the same code both firmwares use. The
+ * channel model:
+ * - slotted schedule (one slot per TX while SLOT_COUNT last) or interval plus
+ *   SLOT_JITTER_MS jitter (unsynced, and slotted TXs beyond SLOT_COUNT);
+ * - uplinks that overlap in time collide and are both lost (no capture effect);
+ * - the receiver is deaf while it sends each ACK (half-duplex);
+ * - the rest are lost at random (--loss) or get 1-3 bit errors (--corrupt)
+ *   before they reach the receiver's checks.
+ * Not modelled: listen-before-talk, ADR, retries and backfill of missed readings.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "../axlewatch_fleet.h"
+#include "../axlewatch_frame.h"
+#include "../axlewatch_log.h"
+#include "../axlewatch_text.h"
+
+// Radio settings - as configured in both firmwares
+#define LORA_SPREADING_FACTOR 7
+#define LORA_BANDWIDTH        125E3
+#define LORA_CODING_RATE      1         // 4/5
+#define LORA_PREAMBLE_SYMBOLS 8
+
+#define RX_SENSOR_SLOTS       (NUM_TEMP_SENSORS + 1)  // Ambient + positions on the receiver
+#define MAX_FRAME_SIZE        (FRAME_HEADER_SIZE + RX_SENSOR_SLOTS * 2 + FRAME_CRC_SIZE)
+
+struct Options {
+  int transmitters = 20;
+  int sensors = 10;             // Values per keyframe (ambient + positions)
+  double minutes = 60;
+  double intervalS = 30;        // Nominal sample interval
+  double intervalSpreadS = 0;   // Each TX adds up to this much to its interval
+  double driftPpm = 50;         // Crystal tolerance, unsynced only
+  double loss = 0;              // Chance an uncollided frame never arrives
+  double corrupt = 0;           // Chance it arrives with bit errors
+  bool unsynced = false;
+  bool bench = false;
+  bool selftest = false;
+  unsigned seed = 1;
+};
+
+struct Uplink {
+  double start;                 // ms
+  double end;
+  int tx;
+  uint8_t sequence;
+  bool collided;
+};
+
+struct Stats {
+  unsigned long sent = 0;
+  unsigned long collided = 0;
+  unsigned long lostToAck = 0;
+  unsigned long lost = 0;
+  unsigned long corruptRejected = 0;
+  unsigned long corruptAccepted = 0;   // Bit errors the CRC missed - should stay 0
+  unsigned long delivered = 0;
+  double airtimeMs = 0;
+  double worstGapMs = 0;               // Longest time any TX went unheard
+};
+
+/**
+ * LoRa time on air (Semtech AN1200.13), explicit header, CRC on
+ */
+double airtimeMs(size_t payloadBytes) {
+  double symbolMs = std::pow(2.0, LORA_SPREADING_FACTOR) / LORA_BANDWIDTH * 1000.0;
+  double bits = 8.0 * payloadBytes - 4 * LORA_SPREADING_FACTOR + 28 + 16;
+  double symbols = 8 + std::max(std::ceil(bits / (4 * LORA_SPREADING_FACTOR)) * (LORA_CODING_RATE + 4), 0.0);
+  return (LORA_PREAMBLE_SYMBOLS + 4.25 + symbols) * symbolMs;
+}
+
+/**
+ * Value transmitter `tx` sends for `slot` in frame `sequence`
+ */
+int16_t expectedCenti(int tx, uint8_t sequence, int slot) {
+  return (int16_t)((2000 + tx * 7 + sequence * 3 + slot * 11) % 12000);
+}
+
+/**
+ * Keyframe from transmitter `tx` with a recognisable value per slot
+ */
+size_t buildKeyframe(uint8_t* frame, int tx, uint8_t sequence, int sensors) {
+  uint16_t mask = (1 << sensors) - 1;
+  size_t len = frameWriteHeader(frame, FRAME_TYPE_READINGS, tx, sequence, 30, mask);
+  for (int i = 0; i < sensors; i++) {
+    len = frameAppendCenti(frame, len, expectedCenti(tx, sequence, i));
+  }
+  return frameFinish(frame, len);
+}
+
+/**
+ * The receiver's checks on a binary frame (LoRaManager::parseBinaryFrame),
+ * decoding the values into centi[]. False if it would be dropped
+ */
+bool acceptFrame(const uint8_t* frame, size_t len, uint16_t* id, uint8_t* sequence,
+                 int16_t* centi) {
+  if (len < FRAME_HEADER_SIZE_V1 + FRAME_CRC_SIZE || frame[0] != FRAME_MAGIC) return false;
+  if (!frameCrcValid(frame, len)) return false;
+
+  uint8_t version = frame[1] >> 4;
+  uint8_t type = frame[1] & 0x0F;
+  if (version < 1 || version > FRAME_VERSION ||
+      (type != FRAME_TYPE_READINGS && type != FRAME_TYPE_DELTA)) {
+    return false;
+  }
+
+  size_t headerSize = (version == 1) ? FRAME_HEADER_SIZE_V1 : FRAME_HEADER_SIZE;
+  uint16_t mask = frame[headerSize - 2] | (frame[headerSize - 1] << 8);
+  if (mask & ~((1 << RX_SENSOR_SLOTS) - 1)) return false;
+  if (len != headerSize + frameValueCount(mask) * 2 + FRAME_CRC_SIZE) return false;
+
+  *id = frame[2] | (frame[3] << 8);
+  *sequence = frame[4];
+  const uint8_t* p = frame + headerSize;
+  for (int slot = 0; slot < RX_SENSOR_SLOTS; slot++) {
+    centi[slot] = 0;
+    if (mask & (1 << slot)) {
+      centi[slot] = frameReadCenti(p);
+      p += 2;
+    }
+  }
+  return true;
+}
+
+/**
+ * Transmit times for every TX over the run
+ * Slotted: every transmitter is entered in a FleetTable as RX would on its first
+ * frame, and one given a transmit slot runs synced from then on: each interval
+ * is rounded to whole slot frames and lands on it. Those RX has no slot for
+ * run unsynced. Unsynced: the TX's own drifting clock plus up to SLOT_JITTER_MS
+ * of random delay
+ */
+std::vector<Uplink> schedule(const Options& opt, std::mt19937& rng, double frameMs) {
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  double durationMs = opt.minutes * 60000.0;
+  std::vector<Uplink> uplinks;
+
+  FleetTable fleet;
+  if (!fleet.begin(opt.transmitters, calloc)) {
+    fprintf(stderr, "fleet table allocation failed\n");
+    exit(1);
+  }
+
+  for (int tx = 0; tx < opt.transmitters; tx++) {
+    double intervalMs = (opt.intervalS + opt.intervalSpreadS * unit(rng)) * 1000.0;
+    char name[16];
+    snprintf(name, sizeof(name), "TX%u", tx);
+    int slot = fleet.findOrCreate(tx, name);
+    fleet.slots[slot].active = true;
+    fleet.updateActive(slot);
+    uint8_t txSlot = fleet.txSlots[slot];
+
+    bool synced = !opt.unsynced && txSlot != 0xFF;
+    double at;
+    if (!synced) {
+      intervalMs *= 1.0 + (unit(rng) * 2 - 1) * opt.driftPpm * 1e-6;
+      at = unit(rng) * intervalMs;
+    } else {
+      intervalMs = std::max(1.0, std::round(intervalMs / SLOT_FRAME_MS)) * SLOT_FRAME_MS;
+      double frames = std::floor(unit(rng) * intervalMs / SLOT_FRAME_MS);
+      at = frames * SLOT_FRAME_MS + txSlot * SLOT_LENGTH_MS;
+    }
+
+    uint8_t sequence = 0;
+    while (at < durationMs) {
+      double start = at + (synced ? 0 : unit(rng) * SLOT_JITTER_MS);
+      uplinks.push_back({start, start + frameMs, tx, sequence++, false});
+      at += intervalMs;
+    }
+  }
+
+  std::sort(uplinks.begin(), uplinks.end(),
+            [](const Uplink& a, const Uplink& b) { return a.start < b.start; });
+  return uplinks;
+}
+
+/**
+ * Mark every uplink that overlaps another one
+ */
+void markCollisions(std::vector<Uplink>& uplinks) {
+  double busyUntil = -1;
+  int last = -1;   // Uplink that reaches furthest so far
+  for (size_t i = 0; i < uplinks.size(); i++) {
+    if (uplinks[i].start < busyUntil) {
+      uplinks[i].collided = true;
+      uplinks[last].collided = true;
+    }
+    if (uplinks[i].end > busyUntil) {
+      busyUntil = uplinks[i].end;
+      last = i;
+    }
+  }
+}
+
+Stats simulate(const Options& opt) {
+  std::mt19937 rng(opt.seed);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+  uint8_t frame[MAX_FRAME_SIZE];
+  size_t frameLen = buildKeyframe(frame, 0, 0, opt.sensors);
+  double frameMs = airtimeMs(frameLen);
+  double ackMs = airtimeMs(ACK_FRAME_SIZE);
+
+  std::vector<Uplink> uplinks = schedule(opt, rng, frameMs);
+  markCollisions(uplinks);
+
+  Stats stats;
+  std::vector<double> lastHeard(opt.transmitters, 0.0);
+  double ackBusyUntil = -1;
+
+  for (const Uplink& up : uplinks) {
+    stats.sent++;
+    stats.airtimeMs += frameMs;
+    if (up.collided) {
+      stats.collided++;
+      continue;
+    }
+    if (up.start < ackBusyUntil) {
+      stats.lostToAck++;
+      continue;
+    }
+    if (unit(rng) < opt.loss) {
+      stats.lost++;
+      continue;
+    }
+
+    size_t len = buildKeyframe(frame, up.tx, up.sequence, opt.sensors);
+    bool corrupted = unit(rng) < opt.corrupt;
+    if (corrupted) {
+      int flips = 1 + (int)(unit(rng) * 3);
+      for (int f = 0; f < flips; f++) {
+        size_t bit = (size_t)(unit(rng) * len * 8);
+        frame[bit / 8] ^= 1 << (bit % 8);
+      }
+    }
+
+    uint16_t id;
+    uint8_t sequence;
+    int16_t centi[RX_SENSOR_SLOTS];
+    if (!acceptFrame(frame, len, &id, &sequence, centi)) {
+      if (corrupted) stats.corruptRejected++;
+      continue;
+    }
+
+    bool intact = id == up.tx && sequence == up.sequence;
+    for (int i = 0; i < opt.sensors && intact; i++) {
+      intact = centi[i] == expectedCenti(up.tx, up.sequence, i);
+    }
+    if (!intact) {
+      stats.corruptAccepted++;
+      continue;
+    }
+
+    stats.delivered++;
+    stats.worstGapMs = std::max(stats.worstGapMs, up.start - lastHeard[up.tx]);
+    lastHeard[up.tx] = up.start;
+    ackBusyUntil = up.end + ackMs;
+    stats.airtimeMs += ackMs;
+  }
+
+  double durationMs = opt.minutes * 60000.0;
+  for (int tx = 0; tx < opt.transmitters; tx++) {
+    stats.worstGapMs = std::max(stats.worstGapMs, durationMs - lastHeard[tx]);
+  }
+  return stats;
+}
+
+/**
+ * Cost of the hot paths on this machine, ns per call
+ */
+void benchmark(const Options& opt) {
+  const int iterations = 2000000;
+  uint8_t frame[MAX_FRAME_SIZE];
+  uint16_t id;
+  uint8_t sequence;
+  int16_t centi[RX_SENSOR_SLOTS];
+  volatile unsigned long sink = 0;
+
+  auto run = [&](const char* name, auto body) {
+    auto started = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) body(i);
+    auto elapsed = std::chrono::steady_clock::now() - started;
+    double ns = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    printf("  %-28s %8.1f ns\n", name, ns);
+  };
+
+  size_t len = buildKeyframe(frame, 1, 0, opt.sensors);
+  printf("Frame: %zu bytes, %.1f ms on air (%d values)\n", len, airtimeMs(len), opt.sensors);
+  run("crc16 (frame body)", [&](int i) { frame[4] = i; sink += crc16(frame, len - FRAME_CRC_SIZE); });
+  run("build keyframe", [&](int i) { sink += buildKeyframe(frame, i & 0xFF, i, opt.sensors); });
+  len = buildKeyframe(frame, 1, 0, opt.sensors);
+  run("accept + decode", [&](int) { sink += acceptFrame(frame, len, &id, &sequence, centi); });
+
+  // The same readings as a legacy text frame, parsed the way RX does
+  TransmitterData tx;
+  char text[96], error[64];
+  int textLen = snprintf(text, sizeof(text), "TX1:");
+  for (int i = 1; i <= NUM_TEMP_SENSORS; i++) {
+    int16_t value = i < opt.sensors ? expectedCenti(1, 0, i) : 0;
+    textLen += snprintf(text + textLen, sizeof(text) - textLen, "%d.%02d,", value / 100, value % 100);
+  }
+  int16_t ambient = expectedCenti(1, 0, 0);
+  textLen += snprintf(text + textLen, sizeof(text) - textLen, "%d.%02d", ambient / 100, ambient % 100);
+  printf("Text frame: %d bytes, %.1f ms on air\n", textLen, airtimeMs(textLen));
+  run("parse text packet", [&](int) { sink += parseTextPacket(text, &tx, error, sizeof(error)); });
+}
+
+/**
+ * Checks on the RX/TX code shared through the headers, returns the failure count
+ */
+int selftest() {
+  int checks = 0, failures = 0;
+  auto check = [&](bool ok, const char* what) {
+    checks++;
+    if (!ok) {
+      failures++;
+      printf("  FAIL %s\n", what);
+    }
+  };
+
+  // parseCenti: two places kept, the third rounds, anything outside int16 fails
+  auto centiOf = [](const char* text, int16_t* centi) {
+    const char* p = text;
+    return parseCenti(&p, centi) && *p == '\0';
+  };
+  int16_t centi = 0;
+  check(centiOf("45.2", &centi) && centi == 4520, "parseCenti 45.2");
+  check(centiOf("-12.345", &centi) && centi == -1235, "parseCenti rounds the third decimal");
+  check(centiOf("327.67", &centi) && centi == 32767, "parseCenti int16 max");
+  check(centiOf("-327.68", &centi) && centi == -32768, "parseCenti int16 min");
+  check(!centiOf("327.68", &centi), "parseCenti overflow");
+  check(!centiOf("", &centi) && !centiOf(".", &centi) && !centiOf("-", &centi), "parseCenti no digits");
+
+  // parseTextPacket: one malformed field rejects the whole packet
+  TransmitterData tx;
+  char error[64];
+  check(parseTextPacket("TX001:45.2,46.1,0.0,0.0,44.8,45.5,0.0,0.0,0.0,22.5", &tx, error, sizeof(error)) &&
+            !strcmp(tx.txID, "TX001") && tx.temps[0] == 45.2f && tx.temps[4] == 44.8f && tx.ambientTemp == 22.5f,
+        "text packet decoded");
+  check(parseTextPacket("DOLLY2:23.8,22.6,22.7,0.0,0.0,0.0,0.0,0.0,0.0,22.8", &tx, error, sizeof(error)),
+        "text packet, DOLLY prefix");
+  check(!parseTextPacket("TX001:45.2,46.1", &tx, error, sizeof(error)) && error[0], "text packet, values missing");
+  check(!parseTextPacket("TX001:23.3.4,0,0,0,0,0,0,0,0,22.5", &tx, error, sizeof(error)) && error[0],
+        "text packet, double decimal point");
+  check(!parseTextPacket("TX0#1:0,0,0,0,0,0,0,0,0,22.5", &tx, error, sizeof(error)) && error[0],
+        "text packet, bad ID character");
+  check(!parseTextPacket("TX001:0,0,0,0,0,0,0,0,0,22.5,1", &tx, error, sizeof(error)) && error[0],
+        "text packet, extra value");
+  check(!parseTextPacket("HELLO", &tx, error, sizeof(error)) && !error[0], "not a text packet");
+
+  // alarmLevel: warn at +40, crit at +60, each left only ALARM_HYSTERESIS_C below
+  check(alarmLevel(61, 20, 40, 60) == 1 && alarmLevel(80, 20, 40, 60) == 2, "alarm thresholds");
+  check(alarmLevel(79, 20, 40, 60, 2) == 2 && alarmLevel(77, 20, 40, 60, 2) == 1, "crit hysteresis");
+  check(alarmLevel(58.5, 20, 40, 60, 1) == 1 && alarmLevel(58.5, 20, 40, 60, 0) == 0, "warn hysteresis");
+  check(alarmLevel(TEMP_INVALID_C, 20, 40, 60, 2) == 2 && alarmLevel(80, TEMP_INVALID_C, 40, 60, 1) == 1,
+        "sensor fault holds the level");
+  check(alarmLevel(0.0f, -50, 40, 60) == 0, "unused sensor ignored");
+
+  // Rate of rise: a hub heating fast alarms well below the offsets
+  auto riseLevel = [](float cPerMin) {
+    TransmitterData hub = {};
+    AlarmState state = {};
+    for (int k = 0; k <= 4; k++) {
+      hub.lastReceived = 1000 + k * 15000UL;
+      hub.ambientTemp = 20;
+      hub.temps[0] = 30 + cPerMin * k * 0.25f;
+      alarmAddRiseSample(&state, &hub);
+    }
+    return alarmEvaluateHubs(&hub, &state, 40, 60);
+  };
+  check(riseLevel(0.5f) == 0 && riseLevel(2.0f) == 1 && riseLevel(4.0f) == 2, "rate of rise levels");
+
+  // FleetTable: one transmit slot each while they last, passed on when freed
+  FleetTable fleet;
+  check(fleet.begin(SLOT_COUNT + 3, calloc), "fleet table allocation");
+  bool unique = true;
+  uint16_t taken = 0;
+  for (int id = 0; id < SLOT_COUNT + 2; id++) {
+    int slot = fleet.findOrCreate(100 + id, "TX");
+    fleet.slots[slot].active = true;
+    fleet.updateActive(slot);
+    uint8_t txSlot = fleet.txSlots[slot];
+    if (id < SLOT_COUNT) {
+      unique = unique && txSlot < SLOT_COUNT && !(taken & (1 << txSlot));
+      taken |= 1 << txSlot;
+    } else {
+      unique = unique && txSlot == 0xFF;
+    }
+  }
+  check(unique, "transmit slots unique, none once all are taken");
+  int text = fleet.findOrCreate(FleetTable::textKey("TRAILER1"), "TRAILER1");
+  fleet.slots[text].active = true;
+  fleet.updateActive(text);
+  check(fleet.txSlots[text] == 0xFF, "no transmit slot for legacy text");
+  int leaving = fleet.find(103);
+  uint8_t freed = fleet.txSlots[leaving];
+  fleet.slots[leaving].active = false;
+  fleet.updateActive(leaving);
+  check(fleet.txSlots[leaving] == 0xFF &&
+            (fleet.txSlots[fleet.find(100 + SLOT_COUNT)] == freed ||
+             fleet.txSlots[fleet.find(101 + SLOT_COUNT)] == freed),
+        "freed transmit slot passed on");
+  check(fleet.find(103) == leaving && fleet.findOrCreate(999, "TX999") == leaving, "inactive slot recycled");
+  check(fleet.find(103) < 0 && fleet.find(999) == leaving, "recycled slot rekeyed");
+  fleet.slots[leaving].active = true;
+  fleet.updateActive(leaving);
+  check(fleet.findOrCreate(1000, "TX1000") < 0 && fleet.rejected == 1, "full table rejects newcomers");
+
+  // Recycling leaves tombstones; the rebuilds they trigger must keep every key findable
+  FleetTable churn;
+  churn.begin(8, calloc);
+  bool findable = true;
+  for (uint32_t id = 0; id < 200; id++) {
+    int slot = churn.findOrCreate(id, "TX");
+    churn.slots[slot].lastReceived = id;
+    for (uint32_t back = 0; back < 8 && back <= id; back++) {
+      findable = findable && churn.find(id - back) >= 0;
+    }
+    findable = findable && (id < 8 || churn.find(id - 8) < 0);
+  }
+  check(findable, "fleet lookups across hash rebuilds");
+
+  // LogRing: sequence numbers survive the wrap, overwritten entries are gone
+  LogRing<4, 16> log;
+  for (int i = 0; i < 6; i++) {
+    snprintf(log.next()->message, 16, "line %d", i);
+    log.next()->timestamp = 7;  // Same millisecond for all of them
+    log.commit();
+  }
+  LogRing<4, 16>::Entry entry;
+  check(log.oldest() == 2 && log.written == 6, "log ring bounds");
+  check(!log.copy(1, &entry) && !log.copy(6, &entry), "log ring, overwritten and unwritten");
+  check(log.copy(2, &entry) && !strcmp(entry.message, "line 2") &&
+            log.copy(5, &entry) && !strcmp(entry.message, "line 5"),
+        "log ring, entries by sequence");
+
+  printf("Selftest: %d checks, %d failed\n", checks, failures);
+  return failures;
+}
+
+void usage() {
+  fprintf(stderr,
+          "usage: fleet_sim [--tx N] [--sensors N] [--minutes M] [--interval S] [--spread S]\n"
+          "                 [--drift PPM] [--loss P] [--corrupt P] [--unsynced] [--seed N] [--bench]\n"
+          "                 [--selftest]\n");
+  exit(2);
+}
+
+int main(int argc, char** argv) {
+  Options opt;
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+    if (!strcmp(arg, "--unsynced")) { opt.unsynced = true; continue; }
+    if (!strcmp(arg, "--bench")) { opt.bench = true; continue; }
+    if (!strcmp(arg, "--selftest")) { opt.selftest = true; continue; }
+    if (!value) usage();
+    if (!strcmp(arg, "--tx")) opt.transmitters = atoi(value);
+    else if (!strcmp(arg, "--sensors")) opt.sensors = atoi(value);
+    else if (!strcmp(arg, "--minutes")) opt.minutes = atof(value);
+    else if (!strcmp(arg, "--interval")) opt.intervalS = atof(value);
+    else if (!strcmp(arg, "--spread")) opt.intervalSpreadS = atof(value);
+    else if (!strcmp(arg, "--drift")) opt.driftPpm = atof(value);
+    else if (!strcmp(arg, "--loss")) opt.loss = atof(value);
+    else if (!strcmp(arg, "--corrupt")) opt.corrupt = atof(value);
+    else if (!strcmp(arg, "--seed")) opt.seed = strtoul(value, nullptr, 10);
+    else usage();
+    i++;
+  }
+  if (opt.transmitters < 1 || opt.transmitters > 65535 ||
+      opt.sensors < 1 || opt.sensors > RX_SENSOR_SLOTS || opt.intervalS <= 0) {
+    usage();
+  }
+
+  if (opt.bench) {
+    benchmark(opt);
+    return 0;
+  }
+  if (opt.selftest) {
+    return selftest() ? 1 : 0;
+  }
+
+  Stats s = simulate(opt);
+  double durationMs = opt.minutes * 60000.0;
+  printf("%d transmitters, %s, %.0f s interval, %.0f min\n", opt.transmitters,
+         opt.unsynced ? "unsynced" : "slotted", opt.intervalS, opt.minutes);
+  printf("  sent              %lu\n", s.sent);
+  printf("  collided          %lu (%.2f%%)\n", s.collided, 100.0 * s.collided / s.sent);
+  printf("  lost to ACK       %lu\n", s.lostToAck);
+  printf("  lost (random)     %lu\n", s.lost);
+  printf("  corrupt, rejected %lu\n", s.corruptRejected);
+  printf("  corrupt, accepted %lu\n", s.corruptAccepted);
+  printf("  delivered         %lu (%.2f%%)\n", s.delivered, 100.0 * s.delivered / s.sent);
+  printf("  channel busy      %.2f%%\n", 100.0 * s.airtimeMs / durationMs);
+  printf("  worst TX silence  %.1f s\n", s.worstGapMs / 1000.0);
+  return s.corruptAccepted ? 1 : 0;
+}
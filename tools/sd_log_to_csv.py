@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""
+Convert binary receiver SD logs (SD_LOG_BINARY) to the CSV the text logger writes.
+
+    python3 tools/sd_log_to_csv.py /media/sd/logs/20250101_000.bin [more.bin ...]
+
+Each input becomes a .csv next to it, or pass -o to write a single file (or -
+for stdout). Layout follows LogFileHeader / LogRecord in AxleWatch_RX_main.ino:
+a 12-byte header, then packed little-endian records. The sensor count comes
+from the header, so logs from builds with another NUM_TEMP_SENSORS convert too.
+A torn last record (power cut mid-write) is skipped.
+"""
+
+import argparse
+import datetime
+import pathlib
+import struct
+import sys
+
+MAGIC = 0x474C5741  # "AWLG"
+VERSIONS = (1, 2)  # v2 added the UTC field
+HEADER = struct.Struct("<IHHB3x")
+NO_POSITION = -2**31
+SENSOR_FAULT = -12700  # TEMP_INVALID_CENTI: the transmitter could not read that sensor
+
+
+def record_format(version, sensors):
+    # timestamp, [utc,] lat, lon, txID, temps, ambient, rssi, speed, sats, alarms
+    utc = "I" if version >= 2 else ""
+    return struct.Struct("<I%sii16s%dhhhHB%dB" % (utc, sensors, sensors))
+
+
+def header_row(sensors):
+    cols = ["Timestamp", "UTC", "TxID"]
+    cols += ["Temp%d" % (i + 1) for i in range(sensors)]
+    cols += ["Ambient", "Lat", "Lon", "Speed", "Sats", "RSSI"]
+    cols += ["Alarm%d" % (i + 1) for i in range(sensors)]
+    return ",".join(cols) + ",\r\n"
+
+
+def iso_utc(seconds):
+    if not seconds:
+        return ""  # Clock was not synced
+    return datetime.datetime.fromtimestamp(seconds, datetime.timezone.utc).strftime("%Y-%m-%dT%H:%M:%SZ")
+
+
+def temp_field(centi):
+    return "" if centi == SENSOR_FAULT else "%.1f" % (centi / 100.0)
+
+
+def csv_row(fields, version, sensors):
+    if version >= 2:
+        utc = fields[1]
+        fields = fields[:1] + fields[2:]
+    else:
+        utc = 0
+    timestamp, lat, lon, tx_id = fields[:4]
+    temps = fields[4:4 + sensors]
+    ambient, rssi, speed, sats = fields[4 + sensors:8 + sensors]
+    alarms = fields[8 + sensors:]
+
+    out = [str(timestamp), iso_utc(utc), tx_id.split(b"\0", 1)[0].decode("ascii", "replace")]
+    out += [temp_field(t) for t in temps]
+    out.append(temp_field(ambient))
+    if lat == NO_POSITION:
+        out += ["", "", "", ""]
+    else:
+        out += ["%.6f" % (lat / 1e6), "%.6f" % (lon / 1e6), "%.1f" % (speed / 10.0), str(sats)]
+    out.append(str(rssi))
+    out += [str(a) for a in alarms]
+    return ",".join(out) + ",\r\n"
+
+
+def convert(path, out, with_header):
+    data = path.read_bytes()
+    if len(data) < HEADER.size:
+        raise ValueError("%s: too short for a log header" % path)
+
+    magic, version, record_size, sensors = HEADER.unpack_from(data)
+    if magic != MAGIC or version not in VERSIONS:
+        raise ValueError("%s: not an AxleWatch binary log (v%d)" % (path, VERSIONS[-1]))
+    record = record_format(version, sensors)
+    if record.size != record_size:
+        raise ValueError("%s: record size %d, expected %d" % (path, record_size, record.size))
+
+    if with_header:
+        out.write(header_row(sensors))
+    count = 0
+    for offset in range(HEADER.size, len(data) - record_size + 1, record_size):
+        out.write(csv_row(record.unpack_from(data, offset), version, sensors))
+        count += 1
+    return count
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("logs", nargs="+", type=pathlib.Path)
+    parser.add_argument("-o", "--output", help="write all logs to one CSV (- for stdout)")
+    args = parser.parse_args()
+
+    try:
+        if args.output:
+            out = sys.stdout if args.output == "-" else open(args.output, "w", newline="")
+            for i, path in enumerate(args.logs):
+                count = convert(path, out, with_header=(i == 0))
+                print("%s: %d records" % (path, count), file=sys.stderr)
+            if out is not sys.stdout:
+                out.close()
+        else:
+            for path in args.logs:
+                target = path.with_suffix(".csv")
+                with open(target, "w", newline="") as out:
+                    count = convert(path, out, with_header=True)
+                print("%s -> %s: %d records" % (path, target, count), file=sys.stderr)
+    except ValueError as error:
+        sys.exit(str(error))
+
+
+if __name__ == "__main__":
+    main()
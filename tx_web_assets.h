@@ -0,0 +1,272 @@
+// Generated by tools/build_web_assets.py from web/tx_*.html - do not edit
+#pragma once
+
+#include <Arduino.h>
+
+// tx_index.html: 12722 bytes, 4177 gzipped
+#define TX_INDEX_HTML_ETAG "\"eab69d2bdbd0aa48\""
+const size_t TX_INDEX_HTML_GZ_LEN = 4177;
+const uint8_t TX_INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x5b, 0x5b, 0x73, 0xdb, 0x46,
+  0xb2, 0x7e, 0xe7, 0xaf, 0x18, 0x2b, 0x75, 0x16, 0xc0, 0x8a, 0xe0, 0x55, 0x76, 0x14, 0xde, 0x5c,
+  0x5e, 0xd9, 0x59, 0xeb, 0x94, 0xed, 0xb8, 0x24, 0xa5, 0x92, 0xaa, 0x6c, 0x1e, 0x40, 0x60, 0x48,
+  0xce, 0x1a, 0x04, 0x10, 0xcc, 0x50, 0x14, 0x97, 0xd6, 0x7f, 0x3f, 0xdd, 0x3d, 0x03, 0x60, 0x00,
+  0x52, 0x17, 0x7b, 0xeb, 0x3c, 0x98, 0x22, 0xe6, 0xd2, 0xdd, 0xd3, 0xfd, 0xf5, 0x6d, 0x40, 0x4f,
+  0x5e, 0x44, 0x69, 0xa8, 0x76, 0x19, 0x67, 0x2b, 0xb5, 0x8e, 0x67, 0x13, 0xf3, 0xc9, 0x83, 0x68,
+  0xd6, 0x9a, 0xac, 0xb9, 0x0a, 0x58, 0xb8, 0x0a, 0x72, 0xc9, 0xd5, 0xd4, 0xd9, 0xa8, 0x85, 0x7f,
+  0xee, 0x14, 0xc3, 0x49, 0xb0, 0xe6, 0x53, 0xe7, 0x56, 0xf0, 0x6d, 0x96, 0xe6, 0xca, 0x61, 0x61,
+  0x9a, 0x28, 0x9e, 0xc0, 0xb2, 0xad, 0x88, 0xd4, 0x6a, 0x1a, 0xf1, 0x5b, 0x11, 0x72, 0x9f, 0x1e,
+  0xda, 0x22, 0x11, 0x4a, 0x04, 0xb1, 0x2f, 0xc3, 0x20, 0xe6, 0xd3, 0xbe, 0xd3, 0x05, 0x22, 0x4a,
+  0xa8, 0x98, 0xcf, 0xde, 0xdc, 0xc5, 0xfc, 0xb7, 0x40, 0x85, 0x2b, 0x76, 0xf3, 0x3b, 0xbb, 0x48,
+  0x93, 0x85, 0x58, 0x4e, 0xba, 0x7a, 0xaa, 0x35, 0x91, 0x6a, 0x87, 0x7f, 0xe7, 0x69, 0xb4, 0xdb,
+  0x2f, 0x80, 0xbc, 0xbf, 0x08, 0xd6, 0x22, 0xde, 0x8d, 0x64, 0x90, 0x48, 0x5f, 0xf2, 0x5c, 0x2c,
+  0xc6, 0xeb, 0x20, 0x5f, 0x8a, 0x64, 0xd4, 0x7f, 0x95, 0xdd, 0x8d, 0xe7, 0x41, 0xf8, 0x65, 0x99,
+  0xa7, 0x9b, 0x24, 0x1a, 0xfd, 0xd0, 0x9b, 0xf7, 0x07, 0x83, 0xde, 0x38, 0x4c, 0xe3, 0x34, 0x1f,
+  0xfd, 0xc0, 0xcf, 0x39, 0x5f, 0x84, 0xf7, 0xad, 0x55, 0x5f, 0xd3, 0x91, 0xe2, 0x3f, 0x7c, 0x34,
+  0xe8, 0xc1, 0x1e, 0xb3, 0xbf, 0xc7, 0x7a, 0x0c, 0x69, 0xdc, 0xb7, 0x3a, 0xeb, 0x8d, 0xe2, 0xd1,
+  0x3e, 0xcd, 0x82, 0x50, 0xa8, 0xdd, 0xa8, 0xf3, 0xe3, 0xb8, 0xda, 0xd1, 0x3f, 0xa3, 0x15, 0x61,
+  0x90, 0x47, 0x7b, 0x9b, 0x59, 0xff, 0xac, 0x3f, 0x1f, 0x44, 0xe3, 0x79, 0x9a, 0x47, 0x3c, 0x1f,
+  0xf5, 0xb3, 0x3b, 0x26, 0xd3, 0x58, 0x44, 0xec, 0x87, 0xe1, 0xf0, 0xcc, 0x8c, 0xfa, 0x79, 0x10,
+  0x89, 0x8d, 0x1c, 0xf5, 0x91, 0x69, 0x16, 0x44, 0x91, 0x48, 0x96, 0x35, 0x09, 0x90, 0x3b, 0xeb,
+  0x19, 0xea, 0x6c, 0x35, 0xd8, 0x1b, 0xd1, 0xcf, 0xc2, 0xf0, 0xa7, 0x45, 0xaf, 0x29, 0x67, 0x41,
+  0x75, 0x9e, 0x2a, 0x95, 0xae, 0x47, 0x83, 0x8a, 0xa5, 0x59, 0x6f, 0x58, 0x14, 0x0b, 0xce, 0x61,
+  0x8b, 0x75, 0x8e, 0x73, 0x3c, 0xc7, 0x42, 0xf0, 0x38, 0x02, 0xc3, 0xee, 0x8f, 0xcb, 0x5d, 0x08,
+  0xd9, 0x1f, 0x58, 0x42, 0x22, 0xa3, 0x5e, 0xe3, 0x48, 0x44, 0x2c, 0xe6, 0x4b, 0x9e, 0x44, 0x0d,
+  0xa1, 0x89, 0xe3, 0x96, 0x8b, 0xe5, 0x4a, 0x8d, 0x5e, 0xf5, 0x4a, 0xa1, 0xe0, 0x14, 0x7a, 0x4f,
+  0x30, 0xe7, 0xf1, 0x3e, 0x12, 0x32, 0x8b, 0x83, 0xdd, 0x68, 0x1e, 0xa7, 0xe1, 0x97, 0x3a, 0x23,
+  0x76, 0x56, 0x88, 0x6d, 0x88, 0xbc, 0xec, 0x81, 0x86, 0x44, 0x92, 0x6d, 0x54, 0x5b, 0xf2, 0x98,
+  0x87, 0x6a, 0x4f, 0xf8, 0x02, 0xad, 0xf6, 0xfe, 0xa7, 0x12, 0xb8, 0x57, 0xe9, 0xc7, 0x88, 0x58,
+  0x69, 0xec, 0xc0, 0x3a, 0x4f, 0x60, 0xa6, 0x61, 0x7d, 0xa0, 0x72, 0x87, 0x4f, 0xc8, 0xa7, 0x34,
+  0xc1, 0x9d, 0x91, 0x69, 0xb4, 0x48, 0xc3, 0x8d, 0x34, 0x92, 0xe9, 0x87, 0x7d, 0xba, 0x51, 0xb1,
+  0x48, 0xf8, 0x28, 0x49, 0x13, 0x5e, 0x08, 0x55, 0x53, 0xd2, 0x7d, 0x6b, 0xbe, 0x01, 0x13, 0x25,
+  0x7b, 0x5b, 0xdf, 0x6c, 0x50, 0x9d, 0x61, 0x74, 0x44, 0xdf, 0x35, 0xb1, 0x8d, 0xb2, 0x0d, 0x55,
+  0x73, 0x08, 0x5b, 0x6b, 0x3f, 0xf6, 0x0a, 0xfc, 0xf8, 0x2a, 0xcd, 0xb4, 0x41, 0x2d, 0xbd, 0x85,
+  0x9b, 0x5c, 0xc2, 0xce, 0x2c, 0x15, 0xe0, 0xc0, 0xb9, 0x7d, 0xe0, 0x97, 0x68, 0x25, 0x2d, 0xde,
+  0x68, 0x95, 0xde, 0xf2, 0xbc, 0x86, 0xfa, 0x61, 0x30, 0x3f, 0x8f, 0x16, 0x80, 0xd8, 0x65, 0x2e,
+  0xa2, 0xd2, 0x8c, 0xf8, 0x30, 0xc6, 0x0f, 0x5f, 0xf1, 0x35, 0x8c, 0x28, 0x8e, 0xe7, 0xdd, 0xac,
+  0x13, 0x39, 0xca, 0x79, 0xc6, 0x03, 0xe5, 0x06, 0x1b, 0x95, 0xfa, 0x0b, 0xa1, 0xda, 0x6b, 0x91,
+  0xac, 0x83, 0x3b, 0xb7, 0x7f, 0x06, 0x87, 0x6d, 0xf7, 0x17, 0xb9, 0xe7, 0x8d, 0x97, 0x41, 0x56,
+  0x07, 0x5c, 0xe1, 0x15, 0x92, 0x27, 0x20, 0x24, 0x2a, 0xbb, 0xee, 0x79, 0xc1, 0x60, 0x38, 0x1c,
+  0x14, 0x9a, 0xb2, 0xdd, 0xe0, 0xec, 0xe5, 0x11, 0xb5, 0x95, 0x3a, 0x46, 0x40, 0x28, 0x7e, 0xa7,
+  0xfc, 0x20, 0x16, 0xcb, 0x64, 0x14, 0x72, 0x3c, 0x7a, 0x8d, 0x0d, 0x5b, 0x0d, 0xf7, 0x0d, 0xdb,
+  0x5b, 0x3e, 0x88, 0xc4, 0xca, 0x10, 0xf1, 0xd3, 0xb8, 0x61, 0x51, 0x9b, 0x4c, 0x07, 0xd5, 0x60,
+  0x51, 0x1a, 0x0e, 0x1a, 0x98, 0x9e, 0xa7, 0x71, 0x54, 0x10, 0xf8, 0x71, 0x1e, 0x9d, 0x9f, 0xa3,
+  0x4a, 0xa5, 0x0a, 0xd4, 0x46, 0xfa, 0x79, 0xba, 0x2d, 0x15, 0xbb, 0x88, 0xf9, 0xdd, 0xf8, 0xdf,
+  0x1b, 0xa9, 0xc4, 0x62, 0xe7, 0x9b, 0x60, 0x3b, 0x92, 0x20, 0x03, 0xf7, 0xe7, 0x5c, 0x6d, 0x39,
+  0x4f, 0xca, 0xe3, 0x9d, 0xdb, 0x5e, 0x6a, 0x22, 0x40, 0x1d, 0xf7, 0x35, 0x16, 0xa3, 0x38, 0x90,
+  0xca, 0x0f, 0x57, 0x22, 0x8e, 0xf6, 0xf5, 0x4d, 0x88, 0xda, 0x6a, 0xa9, 0xf6, 0x57, 0x23, 0xea,
+  0xf9, 0xf9, 0xf9, 0x61, 0x64, 0x34, 0x0b, 0x6f, 0x83, 0x78, 0xc3, 0x9f, 0x88, 0x05, 0xcd, 0xbd,
+  0x3f, 0x60, 0x3c, 0x0f, 0xe2, 0x0f, 0xe9, 0xb2, 0x66, 0xe0, 0x5e, 0xaf, 0x42, 0x76, 0x15, 0xd6,
+  0x34, 0x46, 0x0e, 0xed, 0xbb, 0xd2, 0xf4, 0x87, 0x3d, 0x74, 0x1f, 0x04, 0xec, 0x22, 0x4e, 0xb7,
+  0xfe, 0x6e, 0x84, 0x90, 0x1b, 0xdb, 0x19, 0xc4, 0xb9, 0x48, 0x37, 0xb9, 0xe0, 0x39, 0xfb, 0xc4,
+  0xb7, 0x4e, 0x7b, 0x9d, 0x26, 0x29, 0x69, 0xd2, 0x96, 0x0a, 0x39, 0xa0, 0xeb, 0xfa, 0x86, 0x68,
+  0xbf, 0x73, 0x76, 0x3c, 0x86, 0xc0, 0xb9, 0xe3, 0x74, 0xe9, 0x83, 0x39, 0xf2, 0xdd, 0xde, 0xf8,
+  0x99, 0xd1, 0x9f, 0xd6, 0x8a, 0x12, 0x6b, 0x0e, 0x9a, 0x01, 0x18, 0x98, 0x93, 0xbc, 0x7a, 0xf5,
+  0xaa, 0x70, 0xc8, 0x9c, 0x68, 0x9f, 0x6b, 0xed, 0x6d, 0xc2, 0x90, 0x4b, 0xe9, 0xaf, 0xe5, 0xb2,
+  0x01, 0xf2, 0x61, 0x34, 0x08, 0x8e, 0x30, 0xd7, 0x70, 0xa9, 0x83, 0xe7, 0x29, 0x15, 0x35, 0x03,
+  0x41, 0x01, 0x2f, 0x63, 0xea, 0xb9, 0x4a, 0x0e, 0x51, 0x87, 0x5e, 0xa9, 0x45, 0x34, 0xd3, 0xcc,
+  0xc4, 0x2c, 0x8b, 0xd8, 0x79, 0x15, 0x2b, 0x00, 0xfe, 0x80, 0xcf, 0x28, 0x00, 0x75, 0xd4, 0xe2,
+  0x05, 0x84, 0xdb, 0x46, 0x3e, 0x2e, 0xd6, 0xaf, 0x83, 0x38, 0x2e, 0x03, 0x20, 0xba, 0x7c, 0xdf,
+  0xce, 0xcd, 0x26, 0x58, 0x55, 0x46, 0xd4, 0x06, 0x1a, 0x22, 0x47, 0x15, 0xcc, 0x63, 0x6e, 0x67,
+  0x81, 0x2a, 0xc6, 0xc6, 0x41, 0x26, 0xf9, 0xa8, 0xf8, 0x32, 0x3e, 0xea, 0xcc, 0xa5, 0x1e, 0x80,
+  0x52, 0xd4, 0x56, 0xab, 0x9a, 0x10, 0x67, 0x07, 0x79, 0xb6, 0x91, 0x3c, 0xac, 0x08, 0x12, 0xf3,
+  0x85, 0x02, 0x1a, 0xab, 0x03, 0xf7, 0xb0, 0x33, 0x97, 0xca, 0x3b, 0xdb, 0x20, 0x87, 0xb0, 0xb7,
+  0x64, 0xaa, 0xcc, 0x95, 0x8b, 0xf3, 0x9f, 0x5e, 0xf5, 0xc9, 0xcb, 0xb8, 0xda, 0x64, 0x47, 0x8c,
+  0x6f, 0x47, 0xb8, 0xfe, 0xb3, 0x23, 0x1c, 0xda, 0xf6, 0x51, 0x0f, 0xbc, 0x6f, 0x05, 0x0d, 0x17,
+  0xa5, 0xe3, 0x44, 0x60, 0xbb, 0x3c, 0x50, 0x02, 0x42, 0xbe, 0x86, 0x44, 0x60, 0x42, 0x7f, 0x73,
+  0x16, 0xa4, 0xe3, 0x39, 0x3a, 0xc8, 0x7d, 0x6b, 0xd2, 0x35, 0x95, 0xda, 0xa4, 0x4b, 0x85, 0xe3,
+  0x04, 0x2b, 0x36, 0x78, 0x5a, 0xf5, 0xed, 0xfa, 0x2e, 0x87, 0xaa, 0x6d, 0x2d, 0x14, 0x04, 0x5a,
+  0xe6, 0x9b, 0x52, 0x6f, 0xa3, 0x69, 0xc1, 0xb6, 0x3e, 0x2c, 0xcf, 0x58, 0x08, 0x91, 0x48, 0x4e,
+  0x1d, 0x2a, 0xc1, 0x9c, 0xd9, 0x9b, 0xcf, 0x23, 0x36, 0x01, 0xbf, 0x4c, 0x98, 0x88, 0xa6, 0x4e,
+  0x90, 0x5d, 0x7e, 0x76, 0x66, 0x3e, 0xf0, 0x82, 0x91, 0x19, 0xfb, 0xca, 0xae, 0xaf, 0x2f, 0xdf,
+  0x8e, 0x58, 0xc9, 0xc0, 0xbf, 0xf9, 0x7d, 0xd2, 0xcd, 0x66, 0xad, 0xd6, 0x24, 0x12, 0xb7, 0x05,
+  0x25, 0x2c, 0xa6, 0xb0, 0x62, 0x5d, 0x0d, 0x66, 0x6f, 0xa9, 0x20, 0x3d, 0x60, 0x3c, 0x80, 0xd9,
+  0xa2, 0x12, 0x9a, 0x4d, 0x74, 0x19, 0x53, 0xac, 0xbd, 0xe6, 0x4a, 0x81, 0x32, 0xe5, 0xa4, 0x6b,
+  0xc6, 0x5b, 0x13, 0x8a, 0x81, 0xc5, 0xfc, 0x27, 0x28, 0x81, 0x61, 0x8e, 0x86, 0x5a, 0x13, 0xaa,
+  0x01, 0x18, 0x96, 0xd2, 0x53, 0x07, 0x95, 0xe5, 0x90, 0xd8, 0xba, 0x0e, 0xc6, 0x95, 0x0e, 0x83,
+  0x6c, 0x17, 0xf3, 0x64, 0x09, 0xd5, 0xb1, 0x33, 0xec, 0x3b, 0x25, 0x35, 0x5b, 0x33, 0x97, 0x6f,
+  0x99, 0xdb, 0xf3, 0x5f, 0xbd, 0x7c, 0x39, 0x7c, 0xe9, 0x1d, 0x27, 0x9d, 0x6c, 0xd6, 0x73, 0x9e,
+  0x6b, 0xe2, 0xaa, 0xda, 0x79, 0xf9, 0x16, 0xe8, 0x8b, 0x64, 0xea, 0xf4, 0x88, 0xcf, 0xd4, 0x21,
+  0x1a, 0x0e, 0xa3, 0x58, 0x3c, 0x75, 0x2a, 0x76, 0x8c, 0x6c, 0x05, 0x82, 0xd9, 0x1e, 0x4e, 0x20,
+  0xf6, 0x05, 0xe4, 0x2a, 0x69, 0x92, 0x61, 0xb3, 0x2c, 0xb0, 0xfd, 0x05, 0x9c, 0xc3, 0x69, 0x48,
+  0x15, 0xae, 0x78, 0xf8, 0x05, 0xf2, 0x9d, 0x96, 0x2b, 0x4b, 0xb7, 0x3c, 0xbf, 0x0e, 0x6e, 0xf9,
+  0xc7, 0x34, 0x82, 0x73, 0x1b, 0x8e, 0x96, 0x1b, 0x37, 0xa3, 0x1f, 0x90, 0x7b, 0x97, 0xa0, 0x2b,
+  0xb3, 0xcf, 0xb8, 0x95, 0xe1, 0x5e, 0x86, 0x9b, 0x99, 0xfb, 0x96, 0xf3, 0x8c, 0x5d, 0xc7, 0xf0,
+  0xe9, 0xb5, 0x2a, 0x8d, 0x64, 0x05, 0xd1, 0x46, 0xc4, 0xb6, 0xdc, 0xcf, 0x84, 0x0f, 0x4a, 0x86,
+  0xac, 0xe7, 0xcc, 0x34, 0x65, 0x89, 0x94, 0xd7, 0x48, 0x19, 0x14, 0x80, 0x1c, 0x25, 0xfb, 0x4d,
+  0xfc, 0x2c, 0x58, 0x90, 0x44, 0x6c, 0x23, 0xe1, 0x29, 0x42, 0x7e, 0x12, 0xf9, 0x31, 0x93, 0x57,
+  0x99, 0x51, 0xb3, 0x94, 0x00, 0x19, 0xc9, 0x16, 0x69, 0x8e, 0x1a, 0x16, 0xeb, 0xcd, 0x9a, 0xcd,
+  0x03, 0xd4, 0xfd, 0x8e, 0xc5, 0x62, 0xc1, 0x3b, 0x9a, 0xd0, 0x56, 0xc4, 0x31, 0x4b, 0x93, 0x78,
+  0xc7, 0xb6, 0x69, 0xfe, 0x85, 0x45, 0x90, 0x67, 0xc0, 0xdf, 0x4d, 0x07, 0xc4, 0xc8, 0xc9, 0x3b,
+  0x04, 0xd4, 0x49, 0xb7, 0xc4, 0x5d, 0x6b, 0xa2, 0x23, 0x21, 0xec, 0x0b, 0x63, 0x11, 0x7e, 0x99,
+  0x3a, 0x28, 0xa6, 0x86, 0xaa, 0xeb, 0x39, 0x33, 0x52, 0x47, 0x03, 0xb9, 0x7a, 0xc7, 0xac, 0x06,
+  0x77, 0x2b, 0x83, 0x68, 0x43, 0x84, 0xb4, 0xe7, 0x5a, 0x0f, 0x3b, 0xb3, 0x1a, 0x09, 0x52, 0x45,
+  0xc4, 0xcc, 0x9e, 0xc5, 0x26, 0x8e, 0x77, 0x2f, 0x26, 0x5d, 0xa0, 0x86, 0xa2, 0xd1, 0x9f, 0x87,
+  0x5c, 0xe9, 0x9a, 0xca, 0x1b, 0x76, 0x05, 0xbe, 0xae, 0xdd, 0x83, 0xbc, 0xc8, 0x96, 0xa3, 0xac,
+  0x7f, 0x4a, 0xe3, 0xd7, 0x13, 0xe3, 0x41, 0xbf, 0x56, 0xcb, 0x71, 0x7e, 0x2d, 0xa3, 0x11, 0xd3,
+  0xe1, 0xec, 0xcd, 0x7a, 0x2e, 0x00, 0x99, 0xc0, 0x6c, 0x58, 0x67, 0x86, 0x05, 0x96, 0x71, 0x07,
+  0xf8, 0x06, 0x86, 0xf6, 0xfd, 0xfa, 0x31, 0xec, 0xc5, 0x58, 0x99, 0xea, 0xc5, 0x5a, 0xc6, 0x7f,
+  0xe2, 0x33, 0x2c, 0x79, 0xe1, 0xfb, 0xec, 0x0d, 0x84, 0x4e, 0x54, 0x0c, 0x99, 0x09, 0x27, 0xa5,
+  0x36, 0xe6, 0x1c, 0xb0, 0xb2, 0x83, 0x76, 0x57, 0x40, 0xf7, 0x0a, 0x66, 0x85, 0x08, 0x0b, 0x6a,
+  0x5b, 0xf1, 0x9c, 0x33, 0xdf, 0x3f, 0xca, 0xa4, 0x2a, 0xad, 0x90, 0x34, 0x45, 0xb0, 0xfa, 0x0c,
+  0xa1, 0x18, 0x02, 0x5c, 0xa8, 0xc4, 0x2d, 0x86, 0x19, 0x62, 0x36, 0x32, 0xa1, 0xed, 0xe8, 0x0e,
+  0x72, 0x63, 0x5b, 0x70, 0x28, 0x60, 0x12, 0xe5, 0xcc, 0x7a, 0xe5, 0x26, 0x23, 0x06, 0x25, 0x44,
+  0x5a, 0x07, 0xa1, 0x38, 0x56, 0xab, 0x1b, 0x7c, 0x76, 0x9a, 0x4e, 0x8f, 0xa1, 0x1d, 0x65, 0x53,
+  0x3a, 0x5e, 0xab, 0x1c, 0xfe, 0xad, 0x8c, 0x5d, 0xa1, 0xff, 0x5e, 0xd1, 0xe3, 0xc5, 0xd5, 0x45,
+  0xf9, 0xfd, 0x43, 0x2a, 0x55, 0xf9, 0x70, 0xfe, 0xb2, 0x9a, 0xb8, 0xe2, 0x0a, 0x0a, 0x29, 0x59,
+  0x3e, 0x5f, 0x26, 0x20, 0xaa, 0x88, 0xac, 0xf9, 0xc0, 0x3c, 0x74, 0x91, 0x4b, 0x57, 0x99, 0xab,
+  0x05, 0x85, 0x39, 0xc2, 0x92, 0xf3, 0x2a, 0xdd, 0x02, 0x40, 0x61, 0xde, 0xe4, 0x8e, 0x2e, 0x1d,
+  0xe4, 0xfb, 0xf4, 0xfa, 0x01, 0xea, 0x59, 0xf6, 0x6b, 0x16, 0x41, 0xf3, 0xf1, 0x5c, 0xa5, 0x62,
+  0x09, 0xac, 0x77, 0x38, 0xb3, 0x4f, 0x1c, 0xf2, 0x5d, 0x53, 0xaf, 0xcf, 0xf2, 0x88, 0x6b, 0xf4,
+  0xee, 0x63, 0xee, 0x60, 0x32, 0x7b, 0x61, 0x40, 0x78, 0xfc, 0x08, 0x4f, 0xb3, 0x4f, 0xa9, 0x82,
+  0xc8, 0xa0, 0x83, 0x02, 0x05, 0xa5, 0x82, 0x5b, 0x23, 0x15, 0x56, 0xdb, 0x2e, 0x93, 0x45, 0xea,
+  0xcc, 0x6e, 0xd2, 0x0d, 0x64, 0x54, 0x1e, 0xc0, 0x87, 0x46, 0x03, 0x52, 0x51, 0x9b, 0x3c, 0x61,
+  0x6e, 0xa0, 0xdd, 0x84, 0x2d, 0x44, 0x2e, 0x95, 0xd7, 0x66, 0x30, 0x97, 0x41, 0x44, 0x61, 0x42,
+  0x01, 0x8e, 0xa1, 0x1a, 0xee, 0xb0, 0xf7, 0xd0, 0x70, 0x30, 0x30, 0x83, 0x29, 0xe2, 0xd8, 0x50,
+  0x32, 0x95, 0x02, 0x40, 0x82, 0x1c, 0x76, 0xe5, 0xe9, 0x9a, 0xe6, 0xac, 0xcc, 0x62, 0xa2, 0x95,
+  0x75, 0x1e, 0x53, 0x05, 0xda, 0x62, 0x45, 0x31, 0xe1, 0xa9, 0x11, 0xc6, 0x4e, 0xc2, 0x74, 0x6d,
+  0xe2, 0xa6, 0xeb, 0x10, 0x07, 0xc7, 0x3b, 0x99, 0x5d, 0x13, 0xab, 0xba, 0xca, 0xca, 0x68, 0x76,
+  0xe8, 0x4d, 0x87, 0xdc, 0xb4, 0xdf, 0x3c, 0x08, 0x6a, 0x23, 0x44, 0xa9, 0x7c, 0x53, 0x8c, 0x3a,
+  0xc7, 0xc5, 0x82, 0xf0, 0x93, 0xa2, 0x54, 0xbf, 0xc2, 0x5f, 0x86, 0xc8, 0xb1, 0x84, 0x79, 0xf4,
+  0x38, 0x10, 0x3d, 0xe9, 0x34, 0xf0, 0xf7, 0x70, 0xcb, 0x33, 0x99, 0x87, 0x41, 0x12, 0x02, 0x62,
+  0x81, 0xcc, 0x05, 0x7d, 0x3b, 0x54, 0x44, 0xe5, 0xcf, 0x74, 0xf4, 0x6f, 0x71, 0x67, 0x5d, 0xa5,
+  0x94, 0x9e, 0x78, 0x03, 0xd1, 0xb1, 0x72, 0x4b, 0x21, 0xab, 0x99, 0xcf, 0xa9, 0x14, 0x3a, 0xa9,
+  0x98, 0x81, 0xc7, 0x1d, 0x96, 0x04, 0xd1, 0xc4, 0x8f, 0xbb, 0xec, 0xe3, 0xbe, 0xf2, 0x21, 0xbd,
+  0x0a, 0xd8, 0x35, 0x79, 0xe0, 0x11, 0x57, 0x79, 0xa6, 0x8b, 0xff, 0x9c, 0xf3, 0xbf, 0x36, 0x3c,
+  0x09, 0x77, 0xcf, 0x70, 0xf0, 0xd9, 0xd9, 0x70, 0xc8, 0x3e, 0xbe, 0xff, 0x0f, 0x73, 0xaf, 0x7f,
+  0xfe, 0xb1, 0xcd, 0xfe, 0xf1, 0x5b, 0x7f, 0x80, 0xc5, 0x55, 0xdd, 0xbf, 0xbf, 0x43, 0x86, 0x9b,
+  0xdf, 0x75, 0xb5, 0xf2, 0xdc, 0x18, 0xa3, 0xee, 0x68, 0x79, 0x55, 0xc4, 0xfe, 0x57, 0xcc, 0x53,
+  0x05, 0x79, 0xea, 0x33, 0xa4, 0x50, 0xae, 0x9e, 0x9d, 0x3a, 0x14, 0x6e, 0x32, 0x7b, 0x8e, 0xe4,
+  0x8e, 0xef, 0x0d, 0xb5, 0x37, 0x56, 0x7d, 0xf4, 0x2d, 0x01, 0xf7, 0xe6, 0xee, 0x3b, 0x83, 0x2d,
+  0xde, 0x14, 0x40, 0x79, 0x08, 0x35, 0x15, 0xa6, 0xab, 0x12, 0x43, 0x1a, 0x9c, 0xe6, 0x1a, 0x01,
+  0x91, 0x59, 0xa7, 0x26, 0xc3, 0x5c, 0x64, 0x50, 0x6c, 0x75, 0xbb, 0xec, 0x43, 0x1a, 0x44, 0x2c,
+  0xb4, 0xab, 0xa1, 0xd6, 0x82, 0x43, 0x13, 0xe1, 0x3a, 0xdd, 0x20, 0x13, 0x5d, 0x3d, 0xe3, 0x78,
+  0x2d, 0xc6, 0x3a, 0x80, 0xff, 0xc4, 0xcd, 0xa7, 0xb3, 0xbc, 0xf3, 0x6f, 0x09, 0x2e, 0xeb, 0x55,
+  0x83, 0x90, 0x2d, 0x82, 0xe9, 0x6c, 0x0f, 0xcf, 0x8c, 0x45, 0x69, 0xb8, 0x59, 0x43, 0xdc, 0xed,
+  0x2c, 0xb9, 0x7a, 0x17, 0x73, 0xfc, 0xfa, 0x8f, 0xdd, 0x65, 0xe4, 0xda, 0xf5, 0xbf, 0xd7, 0xd1,
+  0xc5, 0x38, 0xee, 0xeb, 0xe0, 0xf5, 0xf9, 0xf8, 0xf1, 0xad, 0xf5, 0xea, 0xbe, 0xb6, 0xbb, 0x36,
+  0xf5, 0x04, 0x99, 0x7a, 0x31, 0xee, 0x75, 0xa8, 0x54, 0xe7, 0x91, 0x26, 0x54, 0x9b, 0x7c, 0x82,
+  0x10, 0x75, 0x60, 0x5e, 0x07, 0x7b, 0x9b, 0x0b, 0x73, 0xd9, 0x4f, 0x34, 0x70, 0x1c, 0xb7, 0xde,
+  0x7b, 0xe3, 0x16, 0x2a, 0x97, 0xaa, 0xd5, 0x86, 0x72, 0x37, 0x49, 0x58, 0xd6, 0x9c, 0x45, 0x5d,
+  0x8b, 0x9a, 0x83, 0x65, 0x00, 0x20, 0x7a, 0x97, 0xf0, 0x0d, 0x2a, 0x1c, 0x97, 0x3b, 0x6b, 0x8a,
+  0x98, 0x66, 0xf8, 0xa6, 0xe2, 0x32, 0x51, 0xee, 0xb7, 0xe9, 0xd4, 0xab, 0xe8, 0xd5, 0xf4, 0x31,
+  0xfd, 0x56, 0x9d, 0x22, 0x9d, 0x23, 0x38, 0x6a, 0x6b, 0x8c, 0xac, 0xb9, 0x5a, 0xa5, 0xd1, 0xc8,
+  0xf9, 0xfc, 0xcb, 0xf5, 0x8d, 0xd3, 0xa6, 0x21, 0x8c, 0xad, 0x1c, 0x4a, 0xbf, 0xbd, 0x63, 0x34,
+  0xea, 0xdf, 0x40, 0x3b, 0xe5, 0x8c, 0x40, 0xd7, 0x19, 0x64, 0x0b, 0x52, 0x5e, 0x17, 0x71, 0xe7,
+  0xdc, 0xeb, 0x0d, 0x18, 0x6a, 0x47, 0xff, 0x7b, 0xfd, 0xcb, 0xa7, 0x8e, 0x54, 0xd8, 0x58, 0x88,
+  0xc5, 0xce, 0xdd, 0xa3, 0xfa, 0x46, 0xf8, 0xd1, 0xae, 0x1d, 0x6f, 0x54, 0x7b, 0x6a, 0xd7, 0x64,
+  0x1e, 0xd5, 0x9e, 0xee, 0x3d, 0x32, 0xdf, 0xf3, 0xe1, 0xae, 0x95, 0x05, 0x15, 0xcd, 0xc3, 0x2a,
+  0xaa, 0xb7, 0x1e, 0x9e, 0xc6, 0x16, 0xec, 0xe8, 0x50, 0xee, 0xea, 0x98, 0xd4, 0x05, 0xe9, 0x1d,
+  0xef, 0xfd, 0x1d, 0x3d, 0x0d, 0x99, 0xe5, 0x46, 0xac, 0x79, 0xba, 0x51, 0xae, 0xeb, 0x01, 0xaf,
+  0x23, 0xcb, 0x29, 0xd5, 0x8d, 0xef, 0xdb, 0xc3, 0x5e, 0xaf, 0xe7, 0x15, 0xa8, 0xbb, 0x27, 0xdc,
+  0xe9, 0xfa, 0x8d, 0xa1, 0x9c, 0x15, 0xe0, 0x36, 0x34, 0xf8, 0x16, 0xc6, 0x34, 0xe0, 0x6c, 0xf3,
+  0xe0, 0x4a, 0x04, 0x74, 0xf3, 0xc8, 0x7a, 0x44, 0xae, 0xd2, 0x2d, 0xee, 0x23, 0xfa, 0x25, 0x3d,
+  0xe8, 0xfe, 0xd6, 0x81, 0xc2, 0x5c, 0xea, 0x2a, 0x22, 0x98, 0x73, 0x2a, 0xbc, 0xd4, 0x74, 0x3a,
+  0x4d, 0xa0, 0x87, 0x7a, 0xed, 0xbc, 0xbb, 0xba, 0x72, 0x46, 0xaa, 0xa3, 0xd2, 0x9f, 0xc5, 0x1d,
+  0x8f, 0xdc, 0xbe, 0x77, 0xea, 0x5c, 0x38, 0x63, 0xc6, 0x40, 0x42, 0x5c, 0xc0, 0xa6, 0x45, 0xcd,
+  0xb6, 0x49, 0x72, 0x30, 0x3f, 0xe5, 0x77, 0xb5, 0x12, 0x92, 0x85, 0xbb, 0x30, 0xe6, 0x36, 0xaf,
+  0x42, 0x02, 0x52, 0x3d, 0x31, 0x13, 0x0b, 0xfa, 0x6e, 0x2e, 0x98, 0xdf, 0x53, 0xe5, 0xec, 0xe1,
+  0x32, 0xfd, 0xf5, 0xc8, 0xe4, 0xd8, 0xda, 0x45, 0x95, 0xb9, 0xf7, 0x44, 0xc0, 0xb2, 0xdb, 0x8b,
+  0x23, 0xce, 0x1e, 0xe2, 0xc4, 0x53, 0x81, 0x8b, 0xfa, 0xb0, 0xfa, 0x66, 0x4b, 0x6f, 0x3a, 0x82,
+  0xc1, 0x37, 0xf9, 0x47, 0xef, 0x4f, 0x8c, 0x19, 0x15, 0xa2, 0xb0, 0x3d, 0x9b, 0x3e, 0x21, 0x1a,
+  0xb5, 0x6c, 0x06, 0x4f, 0xb8, 0xbe, 0x23, 0x92, 0x84, 0xe7, 0xef, 0x6f, 0x3e, 0x7e, 0x98, 0x3a,
+  0x06, 0x47, 0xc0, 0xcc, 0x8d, 0x39, 0xd4, 0xd6, 0xd3, 0xfe, 0x58, 0x4c, 0x2c, 0xb9, 0xc5, 0xe9,
+  0xa9, 0x39, 0x7f, 0xc1, 0x11, 0x7a, 0xd4, 0x8a, 0x61, 0x08, 0x06, 0x51, 0xdc, 0xf0, 0x84, 0xc0,
+  0x23, 0x6e, 0x0b, 0x46, 0xe8, 0x79, 0x77, 0x1d, 0xca, 0x45, 0x9f, 0xe8, 0xc5, 0xa7, 0xd5, 0xe2,
+  0xda, 0x2b, 0x2c, 0x59, 0xb0, 0x69, 0x2d, 0x2a, 0x2b, 0xe6, 0x9c, 0x8a, 0x53, 0x87, 0x7a, 0x57,
+  0x2b, 0xa9, 0x9d, 0xa0, 0x12, 0x4e, 0x66, 0xce, 0xe9, 0x71, 0xe5, 0x88, 0x3f, 0x3d, 0xdc, 0x83,
+  0xd9, 0xab, 0xe4, 0x41, 0x07, 0x86, 0xe0, 0xc0, 0x93, 0xe8, 0x02, 0x2f, 0xec, 0x5d, 0x60, 0x6a,
+  0x44, 0xbc, 0xb7, 0x15, 0x89, 0xa0, 0x9f, 0x26, 0x7c, 0xcb, 0x00, 0x3f, 0xdc, 0x10, 0x2d, 0xae,
+  0xa1, 0xff, 0xde, 0x2f, 0x7c, 0xe7, 0x11, 0x1b, 0x5a, 0x0d, 0xd1, 0x01, 0x0a, 0x38, 0x80, 0xfb,
+  0x43, 0x8a, 0xef, 0x72, 0xd1, 0x5b, 0xaf, 0x29, 0x10, 0xb9, 0xda, 0x19, 0x8d, 0x2b, 0xfe, 0x92,
+  0xf0, 0xdf, 0x04, 0x34, 0xc8, 0x08, 0x70, 0xa6, 0x1b, 0x3c, 0xe6, 0xeb, 0x5b, 0x11, 0xe8, 0x54,
+  0x4a, 0xe7, 0x6b, 0xb3, 0x44, 0x77, 0x40, 0xd8, 0x72, 0x64, 0x1b, 0xb9, 0x82, 0xc6, 0x1a, 0xea,
+  0x81, 0x44, 0xd5, 0x7d, 0xc0, 0x80, 0x5b, 0xd3, 0xb1, 0xd2, 0x06, 0x06, 0xc3, 0x87, 0xd1, 0x62,
+  0xf5, 0x95, 0x24, 0x1b, 0xae, 0x3e, 0xc0, 0x8a, 0x5e, 0xd4, 0x01, 0x03, 0xbc, 0x83, 0x6e, 0xca,
+  0x75, 0x57, 0x6d, 0xe1, 0xd5, 0x83, 0x1c, 0x94, 0x40, 0x0f, 0x02, 0x44, 0xe5, 0x05, 0x3e, 0xc0,
+  0xc5, 0x56, 0x40, 0x9c, 0x3c, 0x6c, 0xd6, 0xf3, 0x60, 0x93, 0x0d, 0x16, 0x73, 0xeb, 0x6b, 0xac,
+  0x88, 0x93, 0x36, 0x4e, 0x54, 0x04, 0x10, 0x70, 0x05, 0x04, 0x90, 0xde, 0x6b, 0xc7, 0x5c, 0x73,
+  0x40, 0x0a, 0xb0, 0xb1, 0x43, 0x40, 0x50, 0x58, 0xda, 0xe3, 0xda, 0x15, 0xc8, 0x11, 0xbe, 0xcb,
+  0xf3, 0x34, 0x97, 0x8d, 0x71, 0x08, 0x93, 0x20, 0x75, 0xc2, 0x43, 0x25, 0x4f, 0x0d, 0x62, 0xea,
+  0x0b, 0x28, 0xec, 0xff, 0x92, 0x5c, 0x71, 0x08, 0xb5, 0xcd, 0xcd, 0xb9, 0x6e, 0xe5, 0x1b, 0xa3,
+  0xe6, 0x50, 0xa7, 0x4e, 0x57, 0xaf, 0x09, 0xa2, 0xa3, 0xa4, 0x5d, 0x3d, 0xf7, 0xab, 0xec, 0x12,
+  0xba, 0x6a, 0xe1, 0x6f, 0x2d, 0x99, 0x5d, 0x0d, 0x9e, 0x50, 0x53, 0x7b, 0x32, 0x5b, 0x07, 0x77,
+  0x8c, 0x36, 0xc2, 0x97, 0xab, 0x87, 0xf6, 0x9a, 0xd2, 0x90, 0x38, 0x19, 0xfd, 0x91, 0x21, 0x6d,
+  0x1f, 0x00, 0x85, 0x96, 0xa9, 0xe0, 0x11, 0x48, 0xdb, 0x17, 0x22, 0x5e, 0x23, 0xaf, 0x18, 0x1c,
+  0xe8, 0xeb, 0xd9, 0xd7, 0x0e, 0x75, 0x32, 0x60, 0x03, 0x9d, 0x6d, 0x0c, 0xa8, 0x4d, 0xc7, 0xaa,
+  0xbb, 0x75, 0xb7, 0x6a, 0xe3, 0xc0, 0xb2, 0x1e, 0xa0, 0xbb, 0xd1, 0x36, 0x83, 0x1c, 0x5c, 0xea,
+  0x41, 0xea, 0xd6, 0x23, 0xae, 0x38, 0x41, 0xba, 0x8d, 0xb4, 0x28, 0xe0, 0x93, 0x3f, 0x20, 0xc0,
+  0x25, 0xb4, 0xe7, 0x12, 0x5b, 0x70, 0x48, 0x5f, 0x78, 0x11, 0x09, 0xc1, 0x25, 0x82, 0x7c, 0x00,
+  0x1c, 0xe0, 0x49, 0x36, 0x93, 0xd9, 0x45, 0xd5, 0x40, 0x1e, 0xa4, 0xb4, 0x4a, 0xaa, 0xc7, 0x13,
+  0x5b, 0x45, 0xa3, 0x9e, 0xde, 0x32, 0x03, 0x3a, 0xc4, 0xad, 0x9b, 0xd9, 0x09, 0x2e, 0x9b, 0x00,
+  0x3a, 0x7d, 0x67, 0xe4, 0x66, 0x8f, 0x00, 0x35, 0xab, 0x53, 0xab, 0x73, 0xaa, 0xd2, 0xd8, 0x23,
+  0x11, 0xde, 0x5c, 0x8d, 0x1c, 0x2b, 0x33, 0xa9, 0xeb, 0x7f, 0x4d, 0xdf, 0x21, 0x92, 0xc9, 0x60,
+  0xc9, 0x47, 0xae, 0xfd, 0xf4, 0xf5, 0xab, 0x73, 0x70, 0xa1, 0xe2, 0x3c, 0x0e, 0x89, 0xea, 0xf2,
+  0xa2, 0x09, 0x08, 0x9b, 0xa5, 0x86, 0xc1, 0xc8, 0xc1, 0xab, 0x72, 0xe7, 0x69, 0x7a, 0xe6, 0x7a,
+  0xe2, 0x51, 0x8a, 0x44, 0xaa, 0xc4, 0xd7, 0x53, 0x14, 0x8f, 0x63, 0xb6, 0x46, 0xb0, 0x81, 0x58,
+  0x8a, 0x48, 0x2f, 0xac, 0x15, 0x9e, 0x36, 0xe3, 0xf8, 0x99, 0xc1, 0xb3, 0xd6, 0xe3, 0x3f, 0x1c,
+  0x3e, 0x89, 0x81, 0xae, 0xcf, 0x65, 0x15, 0x44, 0xa3, 0xef, 0x0f, 0xa2, 0x51, 0xa7, 0x40, 0xe0,
+  0xa4, 0xf7, 0xb7, 0xbf, 0x45, 0x1d, 0x19, 0xa7, 0x19, 0x9f, 0x4d, 0x7b, 0x9d, 0xc1, 0xe3, 0x31,
+  0xd5, 0x54, 0xef, 0x78, 0xc1, 0xd2, 0x20, 0xa1, 0xbb, 0x1c, 0x33, 0xa0, 0xe1, 0x12, 0xdc, 0x15,
+  0x90, 0x95, 0x26, 0x92, 0xbd, 0x76, 0xea, 0x17, 0x37, 0x27, 0xf4, 0x4a, 0xf2, 0xe4, 0xe8, 0xa5,
+  0xcd, 0xbf, 0x1c, 0x58, 0x21, 0x96, 0xc9, 0xbf, 0x9c, 0x36, 0x65, 0x75, 0xef, 0x64, 0xf6, 0x86,
+  0x06, 0x10, 0xff, 0xb6, 0xfb, 0xd4, 0x58, 0x53, 0x28, 0x33, 0x97, 0x3b, 0x60, 0xa6, 0xc7, 0x52,
+  0x01, 0xd0, 0x3c, 0x1a, 0x2f, 0x9d, 0x53, 0x48, 0xfd, 0x51, 0x94, 0x03, 0xda, 0x41, 0x2f, 0xa0,
+  0x72, 0xd7, 0x7f, 0xd5, 0x8c, 0x90, 0x55, 0x68, 0xa6, 0xa7, 0x88, 0x4a, 0x89, 0x32, 0xa0, 0x0e,
+  0xb0, 0x16, 0xb5, 0x83, 0x76, 0xa5, 0xe0, 0xd7, 0xce, 0x29, 0x8a, 0xe5, 0x9d, 0x9a, 0xa1, 0xfa,
+  0x9e, 0xae, 0x3c, 0x4a, 0xbe, 0x7e, 0xdc, 0xfa, 0x59, 0x4b, 0x26, 0x68, 0x14, 0x33, 0xf0, 0x9c,
+  0x00, 0x6e, 0x85, 0x0f, 0x4b, 0xe9, 0x81, 0x0e, 0x9d, 0x1a, 0x6a, 0xcd, 0x12, 0x60, 0xaf, 0x67,
+  0x47, 0xfa, 0xcf, 0x7d, 0x51, 0xf2, 0xd2, 0xda, 0x17, 0xd3, 0x29, 0xbe, 0xa9, 0x5c, 0x88, 0x84,
+  0x47, 0x1e, 0x31, 0xd6, 0xe3, 0xe6, 0x07, 0x6a, 0xe3, 0x87, 0xe3, 0xe7, 0xff, 0x73, 0xd7, 0x86,
+  0x63, 0xba, 0xed, 0xd2, 0x51, 0x19, 0x1b, 0x1e, 0xab, 0xff, 0x69, 0x86, 0x7a, 0x6c, 0x78, 0xbc,
+  0x66, 0xab, 0x83, 0x57, 0x69, 0xcd, 0xec, 0x80, 0x63, 0x87, 0x79, 0x21, 0x4e, 0xf3, 0x27, 0x5a,
+  0x1d, 0xdc, 0x77, 0x18, 0xbd, 0x89, 0xda, 0xd3, 0x71, 0xbb, 0x76, 0xb1, 0x74, 0x24, 0x76, 0xdb,
+  0xf3, 0x8f, 0x86, 0xbb, 0xe2, 0x8e, 0xec, 0x18, 0x0d, 0x3d, 0x65, 0x37, 0x34, 0x58, 0xa4, 0x6a,
+  0xaa, 0xa8, 0x36, 0xa8, 0xbb, 0xec, 0x98, 0xc3, 0xe9, 0xbd, 0x7f, 0x34, 0xfd, 0x18, 0x60, 0x81,
+  0x17, 0xa7, 0xd0, 0x13, 0xb8, 0x58, 0x0d, 0x77, 0x92, 0x74, 0xeb, 0x7a, 0xfe, 0x11, 0x02, 0x5e,
+  0xf7, 0xb9, 0x95, 0xf1, 0xcd, 0x5d, 0x43, 0x42, 0xc3, 0xec, 0xd4, 0x91, 0x2c, 0x58, 0xa6, 0x8e,
+  0x5d, 0x0b, 0x1b, 0x5b, 0xe9, 0x8b, 0xa9, 0xa2, 0x0a, 0xc6, 0x17, 0xe7, 0x92, 0x41, 0x81, 0x0e,
+  0x85, 0x82, 0x5a, 0x05, 0xba, 0x02, 0x46, 0xca, 0xda, 0x6a, 0x2d, 0xec, 0x5e, 0xf4, 0x8e, 0x0b,
+  0x7a, 0x0f, 0x4b, 0xbd, 0xe5, 0xb8, 0x69, 0x6b, 0x7d, 0x13, 0x76, 0x68, 0x6d, 0xbd, 0x13, 0xfc,
+  0xbb, 0x46, 0xa2, 0x68, 0x50, 0x01, 0xa8, 0xaf, 0xa5, 0x48, 0xc0, 0x07, 0x9c, 0x53, 0x7b, 0x01,
+  0xf5, 0xfa, 0x0f, 0x5c, 0x01, 0x1c, 0xbb, 0x04, 0x28, 0x14, 0x1d, 0xa7, 0xcb, 0xb7, 0xe2, 0xf6,
+  0xb1, 0x5c, 0x52, 0x5c, 0xc9, 0x95, 0xcd, 0x14, 0x18, 0xf0, 0x88, 0x68, 0x5f, 0xbf, 0xea, 0x56,
+  0x8d, 0xc6, 0x26, 0x35, 0xd1, 0x34, 0x8f, 0x23, 0xad, 0x1e, 0xab, 0xab, 0xc9, 0x22, 0x50, 0xcc,
+  0xc3, 0xd6, 0x8b, 0x40, 0xff, 0x56, 0xcb, 0x4c, 0x9b, 0xa7, 0x92, 0x00, 0xe1, 0x7c, 0x29, 0x0d,
+  0xa6, 0xe0, 0x5b, 0xd1, 0x51, 0x91, 0x3f, 0xa0, 0x29, 0x12, 0x30, 0x35, 0x2c, 0xb9, 0xe6, 0x7f,
+  0x4d, 0xfd, 0xfe, 0x98, 0x86, 0x6c, 0xb2, 0x00, 0x9b, 0x71, 0xd3, 0x6f, 0x80, 0x1e, 0x91, 0xaa,
+  0x62, 0xd5, 0x37, 0xea, 0x09, 0x13, 0xb8, 0x39, 0x36, 0xfd, 0x36, 0xeb, 0x13, 0x94, 0x33, 0xd2,
+  0x54, 0xa8, 0x5e, 0x43, 0x20, 0x3a, 0x65, 0x95, 0x81, 0xe9, 0xb7, 0x48, 0x85, 0x99, 0x80, 0x0e,
+  0x3d, 0x77, 0x24, 0xff, 0x6b, 0x52, 0xed, 0x2b, 0x0a, 0x02, 0xba, 0x98, 0x78, 0x13, 0x63, 0xf1,
+  0xbe, 0x2b, 0x7a, 0xb0, 0x00, 0x50, 0x9c, 0x98, 0x4e, 0x0c, 0x49, 0x58, 0xdc, 0x4a, 0x52, 0xa7,
+  0x7d, 0x3b, 0xf3, 0x46, 0xf6, 0xc1, 0x1e, 0x6e, 0xa3, 0x23, 0x3c, 0x4c, 0x95, 0xc3, 0xcb, 0xdf,
+  0x4d, 0xd5, 0xb2, 0xb8, 0x92, 0xb6, 0xcf, 0x6a, 0x86, 0x65, 0xf3, 0x5a, 0x73, 0xd1, 0x3a, 0x22,
+  0x6a, 0x39, 0xb3, 0xdc, 0x70, 0x32, 0xfb, 0xc3, 0x39, 0xc5, 0x5e, 0x47, 0xfe, 0x69, 0x32, 0xa5,
+  0x73, 0xaa, 0x69, 0x9a, 0xb2, 0x51, 0xd3, 0x32, 0x9a, 0xb6, 0xb3, 0x12, 0x90, 0xb7, 0xda, 0x8a,
+  0x2d, 0x8c, 0x71, 0xf7, 0x21, 0x83, 0xcc, 0x2c, 0x38, 0x14, 0x60, 0xcd, 0xf9, 0x3a, 0xbd, 0xe5,
+  0x9a, 0x96, 0x19, 0xa2, 0xb7, 0x72, 0x34, 0x52, 0x98, 0x98, 0xec, 0x66, 0x8c, 0x6a, 0x16, 0xc9,
+  0x30, 0x4f, 0xe3, 0xf8, 0x26, 0xcd, 0xa6, 0xb5, 0x81, 0xf7, 0xf4, 0xd3, 0x9d, 0x22, 0x03, 0x5c,
+  0xf1, 0x05, 0x14, 0x02, 0x2b, 0x06, 0x65, 0x4a, 0x85, 0xbc, 0x5c, 0x0f, 0xbe, 0x89, 0x4d, 0x4c,
+  0xb0, 0x2f, 0xbf, 0xc6, 0xe5, 0xb3, 0xce, 0x10, 0xd5, 0x73, 0x11, 0x45, 0xaa, 0x11, 0xbb, 0xc3,
+  0x28, 0x18, 0x7e, 0xd6, 0xd0, 0xd0, 0x0b, 0xa4, 0x7e, 0x53, 0x48, 0xc1, 0x86, 0x60, 0x22, 0xc7,
+  0x6c, 0x11, 0xe0, 0xbb, 0x72, 0x08, 0xa6, 0xf8, 0x3a, 0x31, 0x03, 0x81, 0xf1, 0x77, 0x0f, 0xa4,
+  0x35, 0x0a, 0x6e, 0x90, 0xf9, 0x78, 0xb0, 0x66, 0xd0, 0xf6, 0x44, 0xe9, 0x36, 0x21, 0x17, 0x32,
+  0x8b, 0x9a, 0xb1, 0x8d, 0x5e, 0x14, 0x7e, 0xd6, 0x73, 0x6e, 0x71, 0xed, 0xf5, 0xc2, 0x2c, 0xf6,
+  0x8a, 0x4d, 0x90, 0x2b, 0x2f, 0xf1, 0x97, 0x29, 0xd0, 0x9d, 0xba, 0xd5, 0xb9, 0xdb, 0x03, 0x0d,
+  0x8f, 0xfb, 0x16, 0xec, 0xd9, 0x8a, 0x04, 0x78, 0x75, 0xde, 0xa1, 0x80, 0xd7, 0xe9, 0x26, 0xaf,
+  0x55, 0x0e, 0x5a, 0x6c, 0xba, 0x23, 0xb1, 0x16, 0x98, 0x00, 0xaa, 0x27, 0x35, 0x6a, 0xf5, 0x77,
+  0xac, 0xbc, 0x68, 0xdd, 0x07, 0x21, 0x21, 0xe2, 0xf3, 0x1c, 0x70, 0x8d, 0xd7, 0x87, 0x6d, 0x0e,
+  0x69, 0xbb, 0xb8, 0xa7, 0xa3, 0x14, 0x4f, 0x97, 0xd0, 0x2e, 0x94, 0xe9, 0x98, 0x35, 0xbd, 0xc7,
+  0x49, 0x50, 0x5a, 0x2e, 0x48, 0x90, 0x5d, 0xbe, 0x99, 0x84, 0x5d, 0xb1, 0x18, 0x42, 0x96, 0xf9,
+  0xbe, 0x43, 0xa2, 0x25, 0xd1, 0xa9, 0x65, 0x52, 0x0a, 0x27, 0x87, 0xa4, 0x8a, 0x4b, 0x5b, 0x2b,
+  0xfe, 0x1e, 0x84, 0x87, 0x32, 0x18, 0xfe, 0x41, 0x53, 0x7f, 0x5a, 0x1e, 0x65, 0x64, 0x48, 0x13,
+  0x28, 0x37, 0x93, 0xa9, 0xeb, 0x59, 0x01, 0xab, 0x30, 0xf6, 0x3e, 0x8c, 0x79, 0x90, 0x97, 0x76,
+  0x2e, 0x86, 0xc7, 0x35, 0xe4, 0xdc, 0xeb, 0x52, 0xda, 0xc2, 0xbe, 0x0e, 0x6a, 0x17, 0xf4, 0xbb,
+  0x33, 0x68, 0x04, 0x01, 0x53, 0x41, 0xb2, 0x83, 0x96, 0x1b, 0x00, 0x89, 0x8a, 0x01, 0x18, 0x6b,
+  0x5c, 0x56, 0xd7, 0x25, 0x3c, 0x42, 0xb1, 0x6a, 0x52, 0x71, 0xbc, 0x60, 0x99, 0xda, 0x60, 0x04,
+  0x58, 0xf1, 0x58, 0x72, 0x94, 0xb2, 0x8e, 0x51, 0xc4, 0x9b, 0x8d, 0xc7, 0xca, 0xef, 0xda, 0xfd,
+  0x97, 0x04, 0x48, 0x12, 0x48, 0xdf, 0x63, 0x31, 0xba, 0x8a, 0x84, 0xfa, 0x91, 0x05, 0x39, 0xa7,
+  0x0b, 0x30, 0x1d, 0x75, 0x5b, 0xb5, 0x13, 0xe0, 0x8f, 0xea, 0xcc, 0xfb, 0x2a, 0xe8, 0x1b, 0xf0,
+  0x05, 0xeb, 0xa4, 0x4b, 0xff, 0x37, 0xa3, 0xf5, 0x7f, 0x87, 0x50, 0x34, 0x41, 0xb2, 0x31, 0x00,
+  0x00,
+};